@@ -0,0 +1,54 @@
+#ifndef TEXTPROCESSING_ARENA_H_INCLUDED
+#define TEXTPROCESSING_ARENA_H_INCLUDED
+
+#include <stddef.h>
+
+/*
+ *  bump pointer allocator for the stuff that the reader functions return (lines, transcoded text, etc.)
+ *  memory is taken from big chunks and there's no way to free a single allocation,
+ *  everything is freed at once with textprocessing_arena_reset (keeps the chunks for reuse) or textprocessing_arena_free
+ *
+ *  allocations are aligned to TEXTPROCESSING_ARENA_ALIGNMENT
+ */
+
+#ifndef TEXTPROCESSING_ARENA_DEFAULT_CHUNK_SIZE
+#define TEXTPROCESSING_ARENA_DEFAULT_CHUNK_SIZE (64 * 1024)
+#endif
+
+#define TEXTPROCESSING_ARENA_ALIGNMENT 16
+
+typedef struct textprocessing_arena_chunk
+{
+    struct textprocessing_arena_chunk *next;
+    size_t size;
+    size_t used;
+} textprocessing_arena_chunk_t;
+
+typedef struct textprocessing_arena
+{
+    textprocessing_arena_chunk_t *head;
+    textprocessing_arena_chunk_t *current;
+    size_t chunk_size;
+} textprocessing_arena_t;
+
+// if chunk_size is 0 then TEXTPROCESSING_ARENA_DEFAULT_CHUNK_SIZE is used
+// no memory is allocated until the first allocation
+void textprocessing_arena_init(textprocessing_arena_t *arena, size_t chunk_size);
+
+// returns NULL and sets errno to ENOMEM on failure
+void *textprocessing_arena_alloc(textprocessing_arena_t *arena, size_t size);
+
+// resizes an allocation, if ptr was the last allocation made it's done in place when it fits
+// otherwise a new block is allocated and old_size bytes are copied into it
+// ptr can be NULL, in which case this is the same as textprocessing_arena_alloc
+void *textprocessing_arena_grow(textprocessing_arena_t *arena, void *ptr, size_t old_size, size_t new_size);
+
+// O(1), makes all the previous allocations invalid but keeps the chunks around to be reused
+void textprocessing_arena_reset(textprocessing_arena_t *arena);
+void textprocessing_arena_free(textprocessing_arena_t *arena);
+
+// returns an arena that belongs to the calling thread (initialized with the default chunk size)
+// the thread should call textprocessing_arena_free on it before exiting if it doesn't want to leak the chunks
+textprocessing_arena_t *textprocessing_arena_thread_local(void);
+
+#endif // TEXTPROCESSING_ARENA_H_INCLUDED
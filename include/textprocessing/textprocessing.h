@@ -9,13 +9,37 @@ typedef enum textprocessing_encoding
 {
     TPENC_ASCII,
     TPENC_UTF8,
+    TPENC_LATIN1, // ISO-8859-1
+    TPENC_CP1252, // Windows-1252, the 5 bytes it leaves undefined are mapped to the C1 control with the same value
     TPENC_UTF16 = 0b100,
     TPENC_UTF16LE,
     TPENC_UTF16BE,
+    TPENC_UTF32 = 0b1000,
+    TPENC_UTF32LE,
+    TPENC_UTF32BE,
 } textprocessing_encoding_t;
 
+// TPENC_UTF16 and TPENC_UTF32 without the endianness are in the byte order of the machine
+#define TPENC_IS_UTF16(enc) (((enc) & ~0b11) == TPENC_UTF16)
+#define TPENC_IS_UTF32(enc) (((enc) & ~0b11) == TPENC_UTF32)
+
+// the size of a single code unit of the encoding in bytes
+int textprocessing_unit_size(textprocessing_encoding_t enc);
+int textprocessing_is_big_endian(textprocessing_encoding_t enc);
+
+// the windows-1252 characters for the bytes 0x80 to 0x9f, the rest is the same as ISO-8859-1
+extern const uint16_t textprocessing_cp1252_c1_table[32];
+
 uint16_t u16_endian_change(uint16_t n, int is_big_endian);
 
 int textprocessing_encode_chr(textprocessing_encoding_t enc, int32_t chr, uint8_t *buffer);
 
+// encodes count characters into buffer (which needs space for 4 bytes per character) and returns how many bytes it wrote
+// encoded gets how many characters were encoded, if it's less than count then chrs[*encoded] couldn't be (errno is set to EILSEQ)
+size_t textprocessing_encode_chrs(textprocessing_encoding_t enc, const int32_t *chrs, size_t count, uint8_t *buffer, size_t *encoded);
+
+// decodes one character from the buffer, returns how many bytes it used,
+// 0 if the buffer ends before the character does or -1 if the character is ill-formed
+int textprocessing_decode_chr(textprocessing_encoding_t enc, const uint8_t *buffer, size_t avail, int32_t *chr);
+
 #endif // TEXTPROCESSING_H_INCLUDED
@@ -4,7 +4,9 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <errno.h>
+#include <wchar.h>
 #include <textprocessing/textprocessing.h>
+#include <textprocessing/arena.h>
 
 #ifndef TEXTREADER_PUSHBACK_BUFFER_SIZE
 #define TEXTREADER_PUSHBACK_BUFFER_SIZE 512
@@ -30,11 +32,39 @@ typedef enum textreader_flags
     TRFLG_EOF,
     TRFLG_ERROR = 4,
     TRFLG_USE_FGETWC = 8,
-    TRFLG_IS_INIT_FILEPTR = 16
+    TRFLG_IS_INIT_FILEPTR = 16,
+    TRFLG_TRACK_POSITION = 32,
+    // replace ill-formed sequences with U+FFFD instead of failing (see textreader_invalid_count)
+    TRFLG_REPLACE_INVALID = 64,
+    // set by textreader_follow, sequences cut off by the end of the file wait for the rest instead of being ill-formed
+    TRFLG_FOLLOW = 128,
+    // set by textreader_prefetch, the file is read in blocks ahead of the decoder
+    TRFLG_PREFETCH = 256
 } textreader_flags_t;
 
+#define TEXTREADER_REPLACEMENT_CHARACTER 0xfffd
+
+struct textreader_pool;
+struct textreader_position_state;
+struct textreader_reverse_state;
+struct textreader_follow_state;
+struct textreader_prefetch_state;
+
+// a block of the data source that's already in memory (the current prefetch buffer)
+typedef struct textreader_window
+{
+    const uint8_t *data;
+    size_t size;
+    size_t index;
+} textreader_window_t;
+
+// the fields getc touches on every call are kept at the top so they share the first cache line
+// the pushback buffer isn't stored inline anymore since most readers never ungetc
+// it gets allocated on the first ungetc (from the reader's pool if it has one) and freed on close
 typedef struct textreader
 {
+    textreader_flags_t flags;
+    textprocessing_encoding_t encoding;
     union
     {
         FILE *file;
@@ -45,14 +75,25 @@ typedef struct textreader
             size_t index;
         } mem;
     } data;
+    size_t total_ungetc_count;
     struct {
         size_t size;
-        char buffer[TEXTREADER_PUSHBACK_BUFFER_SIZE];
+        char *buffer; // TEXTREADER_PUSHBACK_BUFFER_SIZE bytes, NULL until needed
     } ungetc_stack;
-    size_t total_ungetc_count;
+    textreader_window_t *window; // NULL unless prefetching, memory readers use data.mem
+
+    // cold fields
+    struct textreader_pool *pool;
+    struct textreader_position_state *position; // only allocated while TRFLG_TRACK_POSITION is on
+    size_t error_count;
+    off_t first_error_offset;
+    // buffer for functions that return text from readers that aren't reading from memory (see textscan.h)
+    void *scratch;
+    size_t scratch_capacity;
+    struct textreader_reverse_state *reverse; // only allocated when a file is read backwards
+    struct textreader_follow_state *follow; // only allocated while TRFLG_FOLLOW is on
+    struct textreader_prefetch_state *prefetch; // only allocated while TRFLG_PREFETCH is on
     off_t text_start_offset;
-    textreader_flags_t flags;
-    textprocessing_encoding_t encoding;
     int wchar_buffer_used;
     wchar_t wchar_buffer;
 } textreader_t;
@@ -85,10 +126,173 @@ textprocessing_encoding_t textreader_guess_encoding(textreader_t *reader);
 // but it currently just does something like setting the text start offset if there's a BOM for the specified encoding
 int textreader_init_encoding(textreader_t *reader);
 
+// the same thing but the reader is left open if it fails, TRFLG_ERROR is set instead
+int textreader_detect_bom(textreader_t *reader);
+
 int textreader_get_byte(textreader_t *reader);
 int32_t textreader_getc(textreader_t *reader);
 int32_t textreader_ungetc(textreader_t *reader, int32_t chr);
 
+/*
+ *  textreader_getc_inline is textreader_getc for loops that really do have to go one character at a time
+ *  like stdio's getc_unlocked it's in the header so the common case doesn't cost a call:
+ *  when the reader reads from memory or from a prefetched block, nothing is pushed back, position tracking is off
+ *  and the next character is ascii (or a utf-16 unit that isn't a surrogate) it's returned right here,
+ *  everything else goes through textreader_getc
+ */
+static inline int32_t textreader_getc_inline(textreader_t *reader)
+{
+    const uint8_t *data;
+    size_t *index;
+    size_t size;
+    if (reader->flags & TRFLG_ISMEM)
+    {
+        data = (const uint8_t*)reader->data.mem.mem;
+        index = &reader->data.mem.index;
+        size = reader->data.mem.size;
+    }
+    else if (reader->window != NULL)
+    {
+        data = reader->window->data;
+        index = &reader->window->index;
+        size = reader->window->size;
+    }
+    else return textreader_getc(reader);
+
+    size_t i = *index;
+    if ((reader->flags & TRFLG_TRACK_POSITION) || reader->ungetc_stack.size != 0 || reader->total_ungetc_count != 0 || i >= size)
+        return textreader_getc(reader);
+
+    textprocessing_encoding_t enc = reader->encoding;
+    if (enc < TPENC_UTF16)
+    {
+        if (data[i] < 0x80 || enc == TPENC_LATIN1)
+        {
+            *index = i + 1;
+            return data[i];
+        }
+    }
+    else if (TPENC_IS_UTF16(enc) && i + 1 < size)
+    {
+        #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        int big_endian = enc != TPENC_UTF16LE;
+        #else
+        int big_endian = enc == TPENC_UTF16BE;
+        #endif
+        uint16_t unit = big_endian ? (data[i] << 8) | data[i + 1] : data[i] | (data[i + 1] << 8);
+        if ((unit & 0xf800) != 0xd800)
+        {
+            *index = i + 2;
+            return unit;
+        }
+    }
+    return textreader_getc(reader);
+}
+
+/*
+ *  these decode the text and encode it again in out_encoding into memory allocated from the arena
+ *  the result is terminated with a 0 character (in out_encoding) that isn't counted in out_len
+ *
+ *  textreader_getline reads up to and including the next '\n'
+ *  textreader_read_all reads until EOF
+ *
+ *  they return NULL on error or if there's nothing left to read (check textreader_eof)
+ */
+void *textreader_getline(textreader_t *reader, textprocessing_encoding_t out_encoding, textprocessing_arena_t *arena, size_t *out_len);
+void *textreader_read_all(textreader_t *reader, textprocessing_encoding_t out_encoding, textprocessing_arena_t *arena, size_t *out_len);
+
+// decodes up to count characters into buffer, returns how many were decoded
+// a return value less than count means EOF or an error (check textreader_eof/textreader_error)
+size_t textreader_read(textreader_t *reader, int32_t *buffer, size_t count);
+
+/*
+ *  reading backwards
+ *  textreader_getc_prev decodes the character before the current position and moves the reader back to where it starts,
+ *  it returns EOF at the start of the text (after the BOM) or on error
+ *  textreader_read_prev does the same for up to count characters, buffer[0] is the one closest to the old position
+ *
+ *  so the last lines of a text can be found with textreader_seeko(reader, 0, TRSEEK_TEXT_END) and going back
+ *  over count '\n' characters, only the data that was gone back over gets read
+ *
+ *  it works with memory and seekable files (files are read in blocks from the end), getc continues from where it stopped
+ *  on files every call has to move the FILE's position too, so textreader_read_prev is a lot faster than getc_prev in a loop
+ *  pushed back characters are treated as if they were where they were read from
+ *  ill-formed sequences become the same replacement characters that reading forwards would give
+ */
+int32_t textreader_getc_prev(textreader_t *reader);
+size_t textreader_read_prev(textreader_t *reader, int32_t *buffer, size_t count);
+
+/*
+ *  follow mode (like tail -F) for files that are still being written to
+ *
+ *  while it's on, a character that's cut off by the end of the file is kept until the rest of it is written
+ *  instead of becoming an ill-formed sequence, getc just returns EOF like it does at the end of the file
+ *  textreader_follow_wait then blocks until more is written (with inotify on linux, otherwise by checking the file size
+ *  every TEXTREADER_FOLLOW_POLL_INTERVAL milliseconds)
+ *
+ *  if the file gets shorter than the current position it was truncated and reading starts again from the start
+ *  if path is given and a different file shows up there (the log was rotated), the rest of the old file is read first
+ *  and then the reader switches to the new one. the reader owns the new file so textreader_close always closes it,
+ *  a file that was opened with textreader_openfileptr is left open for the caller to close
+ *
+ *  a character that was still waiting for the rest of it when the file is truncated or replaced can't be finished anymore,
+ *  it's ill-formed then (counted by textreader_invalid_count, or an EILSEQ error without TRFLG_REPLACE_INVALID)
+ *  the BOM of the new file is checked once enough of the file is there to tell whether it has one
+ *
+ *  only works with files, returns -1 with errno set to EINVAL for memory readers
+ */
+#ifndef TEXTREADER_FOLLOW_POLL_INTERVAL
+#define TEXTREADER_FOLLOW_POLL_INTERVAL 100
+#endif
+
+int textreader_follow(textreader_t *reader, int enable, const char *path);
+
+// returns 1 once there's something new to read, 0 if timeout_ms (negative for no timeout) ran out first or -1 on error
+int textreader_follow_wait(textreader_t *reader, int timeout_ms);
+
+// textreader_read that waits with textreader_follow_wait when there's nothing to read, 0 means it timed out (or an error)
+size_t textreader_read_follow(textreader_t *reader, int32_t *buffer, size_t count, int timeout_ms);
+
+// used by follow mode before it starts over, reports the bytes of a cut off character as an ill-formed sequence
+// returns -1 if that's an error (no TRFLG_REPLACE_INVALID)
+int textreader_drop_cut_off(textreader_t *reader);
+
+/*
+ *  prefetching for readers of regular files
+ *  the file is read with pread in TEXTREADER_PREFETCH_BLOCK_SIZE blocks into two buffers, while one of them is being decoded
+ *  a helper thread reads the next block into the other one (without threads it's read when it's needed,
+ *  with a read ahead hint to the kernel). textreader_read decodes the blocks in place like it does with memory
+ *
+ *  the reader doesn't go through the FILE while it's on, turning it off moves the FILE to where the reader is
+ *  it can't be turned on with characters pushed back, in follow mode or for anything that isn't a regular file (EINVAL)
+ */
+#ifndef TEXTREADER_PREFETCH_BLOCK_SIZE
+#define TEXTREADER_PREFETCH_BLOCK_SIZE (256 * 1024)
+#endif
+
+int textreader_prefetch(textreader_t *reader, int enable);
+
+/*
+ *  position tracking
+ *  when it's on the reader keeps the line, column and byte offset of the next character up to date
+ *  so that textreader_position is O(1). it follows ungetc and seeks too
+ *
+ *  line and column start at 0, the column is counted in code points
+ *  byte_offset is the offset in the data source (the same thing textreader_tello returns)
+ *
+ *  seeking while tracking rescans the text between the old and new position (or from the start of the text when seeking backwards)
+ */
+typedef struct textreader_position
+{
+    size_t line;
+    size_t column;
+    off_t byte_offset;
+} textreader_position_t;
+
+// starts tracking from the current position of the reader, returns -1 on failure
+int textreader_track_position(textreader_t *reader, int enable);
+textreader_position_t textreader_position(textreader_t *reader);
+
 #define TRSEEK_TEXT_SET 4
 #define TRSEEK_TEXT_CUR 5
 #define TRSEEK_TEXT_END 6
@@ -104,9 +308,47 @@ off_t textreader_tello(textreader_t *reader);
 int textreader_error(textreader_t *reader);
 int textreader_eof(textreader_t *reader);
 
+// how many ill-formed sequences were replaced since the reader was opened or since the last textreader_clearerr
+// first_error_offset gets the data source offset of the first one (or -1 if there were none), it can be NULL
+size_t textreader_invalid_count(textreader_t *reader, off_t *first_error_offset);
+
 void textreader_clearerr(textreader_t *reader);
 
 // if close_file is negative then it will close it depending on if it was open with a file pointer (if it's not then close)
 int textreader_close(textreader_t *reader, int close_file);
 
+/*
+ *  textreader_pool_t is for when you have a lot of readers open at the same time
+ *  all the readers are allocated at once in textreader_pool_init and their pushback buffers
+ *  are handed out from a free list that grows in slabs, so acquiring/releasing readers never calls malloc
+ *  (except when the free list runs out of pushback buffers)
+ *
+ *  pooled readers give their pushback buffer back to the pool as soon as it's empty
+ */
+typedef struct textreader_pool
+{
+    textreader_t *readers;
+    size_t capacity;
+
+    size_t *free_slots;
+    size_t free_slot_count;
+
+    void *free_pushback; // singly linked list of free pushback buffers
+    void *pushback_slabs;
+} textreader_pool_t;
+
+#ifndef TEXTREADER_POOL_PUSHBACK_SLAB_COUNT
+#define TEXTREADER_POOL_PUSHBACK_SLAB_COUNT 64
+#endif
+
+int textreader_pool_init(textreader_pool_t *pool, size_t capacity);
+void textreader_pool_destroy(textreader_pool_t *pool);
+
+// copies the reader (made with textreader_openfileptr, textreader_openmem, etc.) into a free slot of the pool
+// returns NULL and sets errno to ENOMEM if the pool is full
+textreader_t *textreader_pool_acquire(textreader_pool_t *pool, textreader_t reader);
+
+// closes the reader (close_file is the same as textreader_close) and gives the slot back to the pool
+int textreader_pool_release(textreader_pool_t *pool, textreader_t *reader, int close_file);
+
 #endif
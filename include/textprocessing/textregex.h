@@ -0,0 +1,60 @@
+#ifndef TEXTREGEX_H_INCLUDED
+#define TEXTREGEX_H_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+#include <textprocessing/textreader.h>
+
+/*
+ *  small regular expressions that run on a lazily built DFA over utf-8 bytes
+ *  text is scanned once from start to end so the time is always linear in the length of the text
+ *  and utf-8/ascii text doesn't have to be decoded at all
+ *
+ *  supported syntax (the pattern itself is utf-8):
+ *      literals, .             (any character except '\n')
+ *      [abc] [a-z] [^...]      classes can contain any unicode range and \d \w \s
+ *      \d \w \s \D \W \S       ascii digit, word and space characters
+ *      \n \r \t \f \v \xHH \x{HHHHHH} \uHHHH and \ followed by any other character for that character
+ *      (...) (?:...) |         grouping and alternation (groups don't capture anything)
+ *      * + ? {n} {n,} {n,m}    repetition
+ *      ^ $                     match only at the start/end of the text that's searched, they can be anywhere
+ *                              in the pattern and only apply to the branch they're in: ^a|b finds the b in "xb"
+ *                              and a|b$ finds the a in "ax", they can't be repeated
+ *
+ *  the searches report the end of the match that ends first
+ */
+
+typedef struct textregex textregex_t;
+
+#ifndef TEXTREGEX_DEFAULT_CACHE_STATES
+#define TEXTREGEX_DEFAULT_CACHE_STATES 1024
+#endif
+
+// returns NULL and sets errno to EINVAL on a syntax error or to ENOMEM
+textregex_t *textregex_compile(const char *pattern, size_t pattern_len);
+void textregex_free(textregex_t *re);
+
+// the maximum number of DFA states kept at once (each one is a bit over 1kb)
+// the cache is thrown away and rebuilt from the current state when it fills up
+void textregex_set_cache_states(textregex_t *re, size_t max_states);
+
+// returns 1 and puts the offset just past the end of the match in match_end if there's a match, 0 if there isn't
+int textregex_search(textregex_t *re, const void *text, size_t len, size_t *match_end);
+
+// same as textregex_search but the text is an array of code points, match_end is an index into it
+int textregex_search_codepoints(textregex_t *re, const int32_t *text, size_t count, size_t *match_end);
+
+// returns 1 if the whole text matches
+int textregex_match(textregex_t *re, const void *text, size_t len);
+
+/*
+ *  searches the text of the reader starting from its current position
+ *  returns 1 if there's a match, the reader is then positioned right after the end of the match
+ *  returns 0 if it got to EOF without a match or -1 on a read error
+ *
+ *  utf-8 and ascii readers reading from memory are scanned directly without decoding,
+ *  everything else goes through textreader_getc
+ */
+int textregex_search_reader(textregex_t *re, textreader_t *reader);
+
+#endif // TEXTREGEX_H_INCLUDED
@@ -0,0 +1,59 @@
+#ifndef TEXTSCAN_H_INCLUDED
+#define TEXTSCAN_H_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+#include <textprocessing/textreader.h>
+
+/*
+ *  delimiter sets for tokenizing without going character by character through getc/ungetc
+ *
+ *  the ascii members are kept in a bitmap (plus the nibble tables the simd scan uses)
+ *  and everything else in a sorted list of ranges
+ */
+typedef struct textreader_delimset
+{
+    uint64_t ascii[2];
+    uint8_t nibble_lo[16];
+    uint8_t nibble_hi[16];
+
+    struct textreader_delimset_range
+    {
+        int32_t lo, hi;
+    } *ranges;
+    size_t range_count;
+} textreader_delimset_t;
+
+// the text a scan went over, in the encoding of the reader
+// for readers reading from memory it points into that memory, otherwise into a buffer of the reader
+// (the prefetched block the text is in) that's only valid until the next scan or read on the same reader
+typedef struct textreader_view
+{
+    const void *data;
+    size_t size;
+} textreader_view_t;
+
+void textreader_delimset_init(textreader_delimset_t *set);
+void textreader_delimset_free(textreader_delimset_t *set);
+
+int textreader_delimset_add(textreader_delimset_t *set, int32_t chr);
+int textreader_delimset_add_range(textreader_delimset_t *set, int32_t lo, int32_t hi);
+// adds every character of a utf-8 string
+int textreader_delimset_add_string(textreader_delimset_t *set, const char *chars);
+
+int textreader_delimset_contains(const textreader_delimset_t *set, int32_t chr);
+
+/*
+ *  textreader_scan_until reads until the next character that's in the set, the delimiter itself isn't read
+ *  textreader_skip_while reads until the next character that's not in the set
+ *
+ *  out_view gets the text that was read (it can be NULL)
+ *  they return 1 if they stopped at a character, 0 if they got to the end of the text and -1 on an error
+ *
+ *  readers reading from memory or prefetching in a single byte encoding or utf-8 are classified 16 bytes at a time,
+ *  when the set has no non ascii characters the utf-8 text scan_until goes over isn't validated
+ */
+int textreader_scan_until(textreader_t *reader, const textreader_delimset_t *delimiter_set, textreader_view_t *out_view);
+int textreader_skip_while(textreader_t *reader, const textreader_delimset_t *delimiter_set, textreader_view_t *out_view);
+
+#endif // TEXTSCAN_H_INCLUDED
@@ -1,6 +1,117 @@
 #ifndef UNICODE_UTILS_H_INCLUDED
 #define UNICODE_UTILS_H_INCLUDED
 
+#include <stdint.h>
+#include <stddef.h>
+#include <textprocessing/arena.h>
+#include <textprocessing/textprocessing.h>
+#include <textprocessing/textreader.h>
 
+/*
+ *  canonical normalization (NFC and NFD) of utf-8 text
+ *
+ *  text that's already normalized (ascii and most real text) is checked with the quick check properties
+ *  and copied through as it is, only the parts around characters that can change go through
+ *  decomposition, reordering and composition
+ *
+ *  a run of more than UNICODE_NORMALIZER_SEGMENT_SIZE characters that would have to be reordered/composed together
+ *  gets a U+034F COMBINING GRAPHEME JOINER put into it like the stream-safe text format of UAX #15 says,
+ *  that never happens with real text but keeps the memory used by the normalizer bounded
+ */
+
+typedef enum unicode_normalization_form
+{
+    UNICODE_NFC,
+    UNICODE_NFD
+} unicode_normalization_form_t;
+
+#ifndef UNICODE_NORMALIZER_SEGMENT_SIZE
+#define UNICODE_NORMALIZER_SEGMENT_SIZE 32
+#endif
+
+typedef struct unicode_normalizer
+{
+    unicode_normalization_form_t form;
+
+    // the characters that the next characters could still be reordered or composed with
+    int32_t segment[UNICODE_NORMALIZER_SEGMENT_SIZE];
+    size_t segment_len;
+
+    // a character that was cut off by the end of the previous chunk
+    uint8_t partial[4];
+    int partial_len;
+} unicode_normalizer_t;
+
+// the canonical combining class of the character (0 for starters)
+uint8_t unicode_combining_class(int32_t chr);
+
+void unicode_normalizer_init(unicode_normalizer_t *normalizer, unicode_normalization_form_t form);
+
+/*
+ *  normalizes the next chunk of utf-8 text, chunks can end in the middle of a character
+ *  the end of the chunk is kept in the normalizer until the next call since the characters after it could change it,
+ *  is_last flushes everything out (the normalizer can be used again for another text after that)
+ *
+ *  the output is utf-8 allocated from the arena and terminated (the terminator isn't counted in out_len)
+ *  returns NULL and sets errno to EILSEQ if the text isn't valid utf-8 or ENOMEM,
+ *  the normalizer has to be initialized again after an error
+ */
+char *unicode_normalizer_feed(unicode_normalizer_t *normalizer, const void *chunk, size_t len, int is_last,
+                              textprocessing_arena_t *arena, size_t *out_len);
+
+// normalizes the whole text at once, same as a single unicode_normalizer_feed with is_last set
+char *unicode_normalize(unicode_normalization_form_t form, const void *text, size_t len,
+                        textprocessing_arena_t *arena, size_t *out_len);
+
+// returns 1 if the text is normalized, 0 if it isn't or -1 with errno set to EILSEQ or ENOMEM
+// the quick check answers it without normalizing anything unless the text has characters that might compose
+int unicode_is_normalized(unicode_normalization_form_t form, const void *text, size_t len);
+
+/*
+ *  case insensitive comparison and search with the full case folding of CaseFolding.txt,
+ *  so "STRASSE" matches "straße" and "ﬁle" matches "FILE"
+ *
+ *  the texts are folded a character at a time while they're compared, nothing is copied. runs of ascii text in the
+ *  single byte encodings and utf-8 are compared (or searched for the first character of the needle) 32 bytes at a time
+ *
+ *  a match has to start and end at character boundaries of the text, a character that folds into more than one
+ *  character is matched whole or not at all (so "s" isn't found in "ß"). the folded characters aren't normalized,
+ *  normalize both texts first if they could be in different forms
+ *
+ *  in the buffer functions ill-formed sequences aren't errors, every byte of one is compared as a character of its own
+ *  that's only equal to the same byte and sorts after all the real characters
+ */
+
+// the most characters a single character folds into
+#define UNICODE_MAX_FOLD 3
+
+// writes the folded character(s) into out (UNICODE_MAX_FOLD characters) and returns how many there are
+int unicode_casefold(int32_t chr, int32_t *out);
+
+// compares two texts in the same encoding ignoring case, returns -1, 0 or 1 like memcmp does for the folded characters
+int textprocessing_casecmp(textprocessing_encoding_t enc, const void *a, size_t a_len, const void *b, size_t b_len);
+
+// returns 1 if text starts with prefix ignoring case (matched_len gets how many bytes of text that is) or 0 if it doesn't
+int textprocessing_caseprefix(textprocessing_encoding_t enc, const void *text, size_t len, const void *prefix, size_t prefix_len,
+                              size_t *matched_len);
+
+// finds the first match of needle in haystack ignoring case, returns 1 if there's one (match_start and match_len get
+// where it is in bytes, either can be NULL) or 0 if there isn't. an empty needle matches at the start
+int textprocessing_casesearch(textprocessing_encoding_t enc, const void *haystack, size_t len, const void *needle, size_t needle_len,
+                              size_t *match_start, size_t *match_len);
+
+/*
+ *  the same for readers, the prefix and needle are utf-8 whatever the reader's encoding is (EILSEQ if they're not valid)
+ *
+ *  textreader_caseprefix reads the prefix if the text starts with it and returns 1, otherwise it puts the characters
+ *  back and returns 0. the prefix can't fold into more than TEXTREADER_PUSHBACK_BUFFER_SIZE / 4 characters (EINVAL)
+ *
+ *  textreader_casesearch reads up to the end of the first match and returns 1, or to the end of the text and returns 0
+ *  memory readers are searched in place, the others are folded a character at a time as they're read
+ *
+ *  both return -1 on errors
+ */
+int textreader_caseprefix(textreader_t *reader, const char *prefix, size_t prefix_len);
+int textreader_casesearch(textreader_t *reader, const char *needle, size_t needle_len);
 
 #endif // UNICODE_UTILS_H_INCLUDED
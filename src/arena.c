@@ -0,0 +1,143 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#include <textprocessing/arena.h>
+
+#if defined(_MSC_VER)
+    #define THREAD_LOCAL __declspec(thread)
+#else
+    #define THREAD_LOCAL _Thread_local
+#endif
+
+#define ALIGN_UP(n) (((n) + (TEXTPROCESSING_ARENA_ALIGNMENT-1)) & ~(size_t)(TEXTPROCESSING_ARENA_ALIGNMENT-1))
+
+// the chunk header is padded so the data after it stays aligned
+#define CHUNK_HEADER_SIZE ALIGN_UP(sizeof(textprocessing_arena_chunk_t))
+#define CHUNK_DATA(chunk) ((char*)(chunk) + CHUNK_HEADER_SIZE)
+
+// the biggest size that can be aligned and get a chunk header without wrapping around
+#define ARENA_MAX_SIZE (SIZE_MAX - (TEXTPROCESSING_ARENA_ALIGNMENT-1) - CHUNK_HEADER_SIZE)
+
+void textprocessing_arena_init(textprocessing_arena_t *arena, size_t chunk_size)
+{
+    *arena = (textprocessing_arena_t){
+        .head = NULL,
+        .current = NULL,
+        .chunk_size = chunk_size == 0 ? TEXTPROCESSING_ARENA_DEFAULT_CHUNK_SIZE : chunk_size
+    };
+}
+
+static textprocessing_arena_chunk_t *textprocessing_arena_new_chunk(size_t size)
+{
+    textprocessing_arena_chunk_t *chunk = size > ARENA_MAX_SIZE ? NULL : malloc(CHUNK_HEADER_SIZE + size);
+    if (chunk == NULL)
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+    chunk->next = NULL;
+    chunk->size = size;
+    chunk->used = 0;
+    return chunk;
+}
+
+void *textprocessing_arena_alloc(textprocessing_arena_t *arena, size_t size)
+{
+    if (size > ARENA_MAX_SIZE)
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+    size = ALIGN_UP(size);
+    textprocessing_arena_chunk_t *chunk = arena->current;
+    if (chunk != NULL && chunk->size - chunk->used >= size)
+    {
+        void *ptr = CHUNK_DATA(chunk) + chunk->used;
+        chunk->used += size;
+        return ptr;
+    }
+
+    // move on to the next chunk (left over from before a reset) if it's big enough
+    // otherwise put a new one in between
+    textprocessing_arena_chunk_t *next = chunk == NULL ? arena->head : chunk->next;
+    if (next == NULL || next->size < size)
+    {
+        textprocessing_arena_chunk_t *new_chunk = textprocessing_arena_new_chunk(size > arena->chunk_size ? size : arena->chunk_size);
+        if (new_chunk == NULL)
+            return NULL;
+
+        new_chunk->next = next;
+        next = new_chunk;
+        if (chunk == NULL)
+            arena->head = next;
+        else
+            chunk->next = next;
+    }
+    next->used = size;
+    arena->current = next;
+    return CHUNK_DATA(next);
+}
+
+void *textprocessing_arena_grow(textprocessing_arena_t *arena, void *ptr, size_t old_size, size_t new_size)
+{
+    if (ptr == NULL)
+        return textprocessing_arena_alloc(arena, new_size);
+
+    if (new_size > ARENA_MAX_SIZE)
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    textprocessing_arena_chunk_t *chunk = arena->current;
+    size_t old_aligned = ALIGN_UP(old_size);
+    size_t new_aligned = ALIGN_UP(new_size);
+    // it's the last allocation, so it can just be resized
+    if ((char*)ptr + old_aligned == CHUNK_DATA(chunk) + chunk->used
+        && chunk->used - old_aligned + new_aligned <= chunk->size)
+    {
+        chunk->used = chunk->used - old_aligned + new_aligned;
+        return ptr;
+    }
+    if (new_size <= old_size)
+        return ptr;
+
+    void *new_ptr = textprocessing_arena_alloc(arena, new_size);
+    if (new_ptr != NULL)
+        memcpy(new_ptr, ptr, old_size);
+
+    return new_ptr;
+}
+
+void textprocessing_arena_reset(textprocessing_arena_t *arena)
+{
+    // the used count of the next chunks is reset once alloc gets to them
+    if (arena->head != NULL)
+        arena->head->used = 0;
+
+    arena->current = arena->head;
+}
+
+void textprocessing_arena_free(textprocessing_arena_t *arena)
+{
+    textprocessing_arena_chunk_t *chunk = arena->head;
+    while (chunk != NULL)
+    {
+        textprocessing_arena_chunk_t *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    arena->head = NULL;
+    arena->current = NULL;
+}
+
+textprocessing_arena_t *textprocessing_arena_thread_local(void)
+{
+    static THREAD_LOCAL textprocessing_arena_t arena;
+    if (arena.chunk_size == 0)
+        textprocessing_arena_init(&arena, 0);
+
+    return &arena;
+}
@@ -1,5 +1,9 @@
 #include <string.h>
 
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+
 #include <textprocessing/textprocessing.h>
 
 // Changes a 16 bit integer into big or little edian
@@ -14,10 +18,163 @@ uint16_t u16_endian_change(uint16_t n, int is_big_endian)
 
 #define N_BIT_ON(n) ((1 << (n))-1)
 
+const uint16_t textprocessing_cp1252_c1_table[32] = {
+    0x20ac, 0x0081, 0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+    0x02c6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008d, 0x017d, 0x008f,
+    0x0090, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+    0x02dc, 0x2122, 0x0161, 0x203a, 0x0153, 0x009d, 0x017e, 0x0178
+};
+
+int textprocessing_unit_size(textprocessing_encoding_t enc)
+{
+    if (TPENC_IS_UTF32(enc))
+        return 4;
+
+    return TPENC_IS_UTF16(enc) ? 2 : 1;
+}
+
+int textprocessing_is_big_endian(textprocessing_encoding_t enc)
+{
+    if (enc == TPENC_UTF16BE || enc == TPENC_UTF32BE)
+        return 1;
+
+    if (enc == TPENC_UTF16 || enc == TPENC_UTF32)
+    {
+        uint16_t n = 1;
+        return *(uint8_t*)&n == 0;
+    }
+    return 0;
+}
+
+/*
+ *  Decodes a single character from memory
+ *  Returns how many bytes it took, 0 if the buffer ends in the middle of the character
+ *  or -1 if it's ill-formed (utf-8 is checked against the well-formed byte sequences table of the unicode standard)
+ */
+int textprocessing_decode_chr(textprocessing_encoding_t enc, const uint8_t *buffer, size_t avail, int32_t *chr)
+{
+    if (avail == 0)
+        return 0;
+
+    uint8_t c = buffer[0];
+    switch (enc)
+    {
+    case TPENC_ASCII:
+        if (c >= 0x80)
+            return -1;
+
+        *chr = c;
+        return 1;
+    case TPENC_LATIN1:
+        *chr = c;
+        return 1;
+    case TPENC_CP1252:
+        *chr = c >= 0x80 && c < 0xa0 ? textprocessing_cp1252_c1_table[c - 0x80] : c;
+        return 1;
+    case TPENC_UTF8:
+        {
+            if (c < 0x80)
+            {
+                *chr = c;
+                return 1;
+            }
+            int need;
+            uint8_t lower = 0x80, upper = 0xbf;
+            int32_t rslt;
+            if (c >= 0xc2 && c <= 0xdf)
+            {
+                need = 1;
+                rslt = c & N_BIT_ON(5);
+            }
+            else if (c >= 0xe0 && c <= 0xef)
+            {
+                need = 2;
+                rslt = c & N_BIT_ON(4);
+                if (c == 0xe0)
+                    lower = 0xa0;
+                else if (c == 0xed)
+                    upper = 0x9f;
+            }
+            else if (c >= 0xf0 && c <= 0xf4)
+            {
+                need = 3;
+                rslt = c & N_BIT_ON(3);
+                if (c == 0xf0)
+                    lower = 0x90;
+                else if (c == 0xf4)
+                    upper = 0x8f;
+            }
+            else return -1;
+
+            for (int i = 1; i <= need; ++i)
+            {
+                if ((size_t)i >= avail)
+                    return 0;
+
+                if (buffer[i] < lower || buffer[i] > upper)
+                    return -1;
+
+                lower = 0x80;
+                upper = 0xbf;
+                rslt = (rslt << 6) | (buffer[i] & N_BIT_ON(6));
+            }
+            *chr = rslt;
+            return need + 1;
+        }
+    case TPENC_UTF16:
+    case TPENC_UTF16LE:
+    case TPENC_UTF16BE:
+        {
+            if (avail < 2)
+                return 0;
+
+            int high = textprocessing_is_big_endian(enc) ? 0 : 1;
+            uint16_t unit = (buffer[high] << 8) | buffer[1-high];
+            if ((unit & 0xf800) != 0xd800)
+            {
+                *chr = unit;
+                return 2;
+            }
+            if ((unit & 0xfc00) != 0xd800)
+                return -1;
+
+            if (avail < 4)
+                return 0;
+
+            uint16_t low = (buffer[2 + high] << 8) | buffer[3-high];
+            if ((low & 0xfc00) != 0xdc00)
+                return -1;
+
+            *chr = ((((int32_t)unit & 0x3ff) << 10) | (low & 0x3ff)) + 0x10000;
+            return 4;
+        }
+    case TPENC_UTF32:
+    case TPENC_UTF32LE:
+    case TPENC_UTF32BE:
+        {
+            if (avail < 4)
+                return 0;
+
+            int is_be = textprocessing_is_big_endian(enc);
+            uint32_t rslt = 0;
+            for (int i = 0; i < 4; ++i)
+                rslt |= (uint32_t)buffer[is_be ? 3-i : i] << (i * 8);
+
+            if (rslt > 0x10ffff || (rslt & 0xfffff800) == 0xd800)
+                return -1;
+
+            *chr = (int32_t)rslt;
+            return 4;
+        }
+    }
+    errno = EINVAL;
+    return -1;
+}
+
 // Encodes the character into the buffer
 int textprocessing_encode_chr(textprocessing_encoding_t enc, int32_t chr, uint8_t *buffer)
 {
-    if (((TPENC_UTF8 | TPENC_UTF16LE | TPENC_UTF16BE) & enc) && chr > 1048576)
+    if (chr < 0 || chr > 0x10ffff)
     {
         errno = EILSEQ;
         return -1;
@@ -25,13 +182,49 @@ int textprocessing_encode_chr(textprocessing_encoding_t enc, int32_t chr, uint8_
     switch (enc)
     {
     case TPENC_ASCII:
-        if (chr > 0x80)
+        if (chr >= 0x80)
         {
             errno = EILSEQ;
             return -1;
         }
         buffer[0] = (char)chr;
         return 1;
+    case TPENC_LATIN1:
+        if (chr > 0xff)
+        {
+            errno = EILSEQ;
+            return -1;
+        }
+        buffer[0] = (uint8_t)chr;
+        return 1;
+    case TPENC_CP1252:
+        if (chr < 0x80 || (chr >= 0xa0 && chr <= 0xff))
+        {
+            buffer[0] = (uint8_t)chr;
+            return 1;
+        }
+        for (int i = 0; i < 32; ++i)
+        {
+            if (textprocessing_cp1252_c1_table[i] == chr)
+            {
+                buffer[0] = 0x80 + i;
+                return 1;
+            }
+        }
+        errno = EILSEQ;
+        return -1;
+    case TPENC_UTF32:
+        memcpy(buffer, &chr, 4);
+        return 4;
+    case TPENC_UTF32LE:
+    case TPENC_UTF32BE:
+        {
+            int is_be = enc == TPENC_UTF32BE;
+            for (int i = 0; i < 4; ++i)
+                buffer[is_be ? 3-i : i] = (chr >> (i * 8)) & 0xff;
+
+            return 4;
+        }
     case TPENC_UTF16BE:
     case TPENC_UTF16LE:
     case TPENC_UTF16:
@@ -69,7 +262,7 @@ int textprocessing_encode_chr(textprocessing_encoding_t enc, int32_t chr, uint8_
             return len;
         }
     case TPENC_UTF8:
-        if (chr <= 0x80)
+        if (chr < 0x80)
         {
             buffer[0] = chr;
             return 1;
@@ -114,3 +307,147 @@ int textprocessing_encode_chr(textprocessing_encoding_t enc, int32_t chr, uint8_
     errno = EINVAL;
     return -1;
 }
+
+#ifdef __SSE2__
+// 1 if all of the 16 characters are below limit (which is a power of 2)
+static int textprocessing_all_below(const int32_t *chrs, int32_t limit)
+{
+    __m128i any = _mm_or_si128(
+        _mm_or_si128(_mm_loadu_si128((const __m128i*)chrs), _mm_loadu_si128((const __m128i*)(chrs + 4))),
+        _mm_or_si128(_mm_loadu_si128((const __m128i*)(chrs + 8)), _mm_loadu_si128((const __m128i*)(chrs + 12))));
+
+    __m128i high = _mm_and_si128(any, _mm_set1_epi32(~(limit - 1)));
+    return _mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128())) == 0xffff;
+}
+
+// narrows 16 characters that are all below 0x100 into bytes
+static void textprocessing_narrow_bytes(const int32_t *chrs, uint8_t *out)
+{
+    __m128i lo = _mm_packs_epi32(_mm_loadu_si128((const __m128i*)chrs), _mm_loadu_si128((const __m128i*)(chrs + 4)));
+    __m128i hi = _mm_packs_epi32(_mm_loadu_si128((const __m128i*)(chrs + 8)), _mm_loadu_si128((const __m128i*)(chrs + 12)));
+    _mm_storeu_si128((__m128i*)out, _mm_packus_epi16(lo, hi));
+}
+#endif
+
+/*
+ *  the single byte encodings and utf-8 go through runs of characters that fit in a byte 16 at a time,
+ *  utf-16 and utf-32 write the units directly and everything else goes through textprocessing_encode_chr
+ */
+size_t textprocessing_encode_chrs(textprocessing_encoding_t enc, const int32_t *chrs, size_t count, uint8_t *buffer, size_t *encoded)
+{
+    size_t i = 0, used = 0;
+    int32_t direct_limit = enc == TPENC_LATIN1 ? 0x100 : 0x80;
+    switch (enc)
+    {
+    case TPENC_ASCII:
+    case TPENC_UTF8:
+    case TPENC_LATIN1:
+    case TPENC_CP1252:
+        while (i < count)
+        {
+#ifdef __SSE2__
+            while (i + 16 <= count && textprocessing_all_below(chrs + i, direct_limit))
+            {
+                textprocessing_narrow_bytes(chrs + i, buffer + used);
+                i += 16;
+                used += 16;
+            }
+#endif
+            while (i < count && chrs[i] >= 0 && chrs[i] < direct_limit)
+                buffer[used++] = (uint8_t)chrs[i++];
+
+            // the run ended, encode characters one by one until there's a run again
+            for (int left = 16; i < count && left > 0; --left, ++i)
+            {
+                int32_t chr = chrs[i];
+                if (chr >= 0 && chr < direct_limit)
+                    break;
+
+                if (enc == TPENC_UTF8 && chr >= 0 && chr <= 0x10ffff)
+                {
+                    uint8_t *p = buffer + used;
+                    if (chr < 0x800)
+                    {
+                        p[0] = 0xc0 | (chr >> 6);
+                        p[1] = 0x80 | (chr & 0x3f);
+                        used += 2;
+                    }
+                    else if (chr < 0x10000)
+                    {
+                        p[0] = 0xe0 | (chr >> 12);
+                        p[1] = 0x80 | ((chr >> 6) & 0x3f);
+                        p[2] = 0x80 | (chr & 0x3f);
+                        used += 3;
+                    }
+                    else
+                    {
+                        p[0] = 0xf0 | (chr >> 18);
+                        p[1] = 0x80 | ((chr >> 12) & 0x3f);
+                        p[2] = 0x80 | ((chr >> 6) & 0x3f);
+                        p[3] = 0x80 | (chr & 0x3f);
+                        used += 4;
+                    }
+                    continue;
+                }
+                int len = textprocessing_encode_chr(enc, chr, buffer + used);
+                if (len < 0)
+                    goto end;
+
+                used += len;
+            }
+        }
+        break;
+    case TPENC_UTF16:
+    case TPENC_UTF16LE:
+    case TPENC_UTF16BE:
+        {
+            int swap = textprocessing_is_big_endian(enc) != textprocessing_is_big_endian(TPENC_UTF16);
+            for (; i < count; ++i)
+            {
+                int32_t chr = chrs[i];
+                if (chr < 0 || chr > 0xffff || (chr & 0xf800) == 0xd800)
+                {
+                    int len = textprocessing_encode_chr(enc, chr, buffer + used);
+                    if (len < 0)
+                        goto end;
+
+                    used += len;
+                    continue;
+                }
+                uint16_t unit = swap ? (uint16_t)((chr >> 8) | (chr << 8)) : (uint16_t)chr;
+                memcpy(buffer + used, &unit, 2);
+                used += 2;
+            }
+        }
+        break;
+    case TPENC_UTF32:
+    case TPENC_UTF32LE:
+    case TPENC_UTF32BE:
+        {
+            int swap = textprocessing_is_big_endian(enc) != textprocessing_is_big_endian(TPENC_UTF32);
+            for (; i < count; ++i)
+            {
+                uint32_t chr = (uint32_t)chrs[i];
+                if (chr > 0x10ffff)
+                {
+                    errno = EILSEQ;
+                    goto end;
+                }
+                if (swap)
+                    chr = (chr >> 24) | ((chr >> 8) & 0xff00) | ((chr << 8) & 0xff0000) | (chr << 24);
+
+                memcpy(buffer + used, &chr, 4);
+                used += 4;
+            }
+        }
+        break;
+    default:
+        errno = EINVAL;
+        break;
+    }
+end:
+    if (encoded != NULL)
+        *encoded = i;
+
+    return used;
+}
@@ -6,8 +6,89 @@
 
 #include <textprocessing/textreader.h>
 
+#if defined(unix) || defined(__unix__) || defined(__unix) || defined(__APPLE__)
+    #include <unistd.h>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #define TEXTREADER_HAVE_PREAD
+#endif
+
+#ifdef TEXTREADER_HAVE_THREADS
+    #include <pthread.h>
+#endif
+
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+
 #define N_BIT_ON(n) ((1 << (n))-1)
 
+#ifndef TEXTREADER_SCAN_BLOCK_SIZE
+#define TEXTREADER_SCAN_BLOCK_SIZE (16 * 1024)
+#endif
+
+#ifndef TEXTREADER_REVERSE_BLOCK_SIZE
+#define TEXTREADER_REVERSE_BLOCK_SIZE (64 * 1024)
+#endif
+
+// how many line end columns are remembered so ungetc'ing a '\n' doesn't need a rescan
+#define TEXTREADER_POSITION_HISTORY 4
+
+struct textreader_position_state
+{
+    textreader_position_t pos;
+    size_t line_end_columns[TEXTREADER_POSITION_HISTORY];
+    int line_end_count;
+    int line_end_next;
+    // a block can end in the middle of a character, this is how many more utf-8 bytes it needs
+    // (with the range the next one has to be in) or 1 after a utf-16 high surrogate
+    int pending;
+    uint8_t lower, upper;
+};
+
+/*
+ *  prefetching reads the file with pread into two buffers, the reader decodes one of them
+ *  while the helper thread reads the next block into the other one (and asks the kernel to start on the block after that)
+ *  once the reader gets to the end of its buffer the buffers are swapped, so nothing gets copied
+ *
+ *  without threads the next block is read when it's needed, the read ahead hint still lets the kernel read it early
+ */
+struct textreader_prefetch_state
+{
+    int fd;
+    uint8_t *buffers[2];
+    size_t lens[2];
+    off_t offsets[2];
+    int current;
+    // buffers[current] as the reader sees it, the inline getc in textreader.h reads from it through reader->window
+    textreader_window_t window;
+
+    // the other buffer holds (or is getting) the block after the current one
+    int ahead_valid;
+    int ahead_error;
+    #ifdef TEXTREADER_HAVE_THREADS
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int requested;
+    int stop;
+    #endif
+};
+
+// the block of the file that's being decoded backwards, it holds the bytes [block_start, block_start + block_len)
+struct textreader_reverse_state
+{
+    off_t block_start;
+    size_t block_len;
+    uint8_t block[TEXTREADER_REVERSE_BLOCK_SIZE];
+};
+
+static void textreader_position_after_seek(textreader_t *reader);
+static void textreader_position_unconsume(textreader_t *reader, int32_t chr, int byte_count);
+static off_t textreader_source_offset(textreader_t *reader);
+static int textreader_alloc_pushback(textreader_t *reader);
+static int textreader_source_len(textprocessing_encoding_t enc, int32_t chr);
+
 textreader_t textreader_openfileptr(FILE *file, textprocessing_encoding_t encoding)
 {
     return (textreader_t){
@@ -17,7 +98,8 @@ textreader_t textreader_openfileptr(FILE *file, textprocessing_encoding_t encodi
         .flags = TRFLG_IS_INIT_FILEPTR,
         .encoding = encoding,
         .ungetc_stack = {
-            .size = 0
+            .size = 0,
+            .buffer = NULL
         }
     };
 }
@@ -46,49 +128,45 @@ textreader_t textreader_openmem(const void *mem, size_t size, textprocessing_enc
         .flags = TRFLG_ISMEM,
         .encoding = encoding,
         .ungetc_stack = {
-            .size = 0
+            .size = 0,
+            .buffer = NULL
         }
     };
 }
 
 textprocessing_encoding_t textreader_check_bom(textreader_t *reader)
 {
-    unsigned char buf[2];
-    textprocessing_encoding_t rslt = -2;
-    // printf("Entered check_bom\n");
-    for (int i = 0; i < 4; ++i)
+    unsigned char buf[4];
+    int len = 0;
+    for (; len < 4; ++len)
     {
         int c = textreader_get_byte(reader);
-        buf[i] = c;
-        // printf("%i. Read '\\x%x'\n", i, (unsigned char)c);
         if (c == EOF)
         {
-            // printf("EOF when checking for BOM\n");
-            if (textreader_eof(reader))
-                return rslt;
+            if (!textreader_eof(reader))
+                return -1;
 
-            return -1;
-        }
-        if (i == 1)
-        {
-            // printf("First two characters are: \\x%x\\x%x\n", buf[0], buf[1]);
-            if (!memcmp(buf, "\xff\xfe", 2))
-                rslt = TPENC_UTF16LE;
-            else if (!memcmp(buf, "\xfe\xff", 2))
-                rslt = TPENC_UTF16BE;
+            break;
         }
-        else if (i == 2)
-        {
-            // printf("First three characters are: \\x%x\\x%x\\x%x\n", buf[0], buf[1], buf[2]);
-            if (!memcmp(buf, "\xef\xbb\xbf", 3))
-                rslt = TPENC_UTF8;
-        }
-        // printf("rslt is %i\n", rslt);
-        if (rslt != -2)
-            return rslt;
+        buf[len] = c;
     }
+    // the utf-32le BOM starts with the utf-16le one so it has to be checked first
+    if (len >= 4 && !memcmp(buf, "\xff\xfe\x00\x00", 4))
+        return TPENC_UTF32LE;
 
-    return rslt;
+    if (len >= 4 && !memcmp(buf, "\x00\x00\xfe\xff", 4))
+        return TPENC_UTF32BE;
+
+    if (len >= 3 && !memcmp(buf, "\xef\xbb\xbf", 3))
+        return TPENC_UTF8;
+
+    if (len >= 2 && !memcmp(buf, "\xff\xfe", 2))
+        return TPENC_UTF16LE;
+
+    if (len >= 2 && !memcmp(buf, "\xfe\xff", 2))
+        return TPENC_UTF16BE;
+
+    return -2;
 }
 
 // Guess encoding is done in textreader_init_encoding
@@ -167,35 +245,423 @@ int textreader_init(textreader_t *reader, void *data, size_t memlen, textprocess
 }
 
 int textreader_init_encoding(textreader_t *reader)
+{
+    if (textreader_detect_bom(reader) != 0)
+    {
+        textreader_close(reader, -1);
+        return -1;
+    }
+    return 0;
+}
+
+int textreader_detect_bom(textreader_t *reader)
 {
     textprocessing_encoding_t bom = textreader_check_bom(reader);
 
-    // mark
-    if (bom != -2 && (bom == reader->encoding || reader->encoding == -1))
+    // utf-16le text that starts with U+0000 looks like it has a utf-32le BOM
+    if (bom == TPENC_UTF32LE && TPENC_IS_UTF16(reader->encoding))
+        bom = TPENC_UTF16LE;
+
+    // the machine endianness encodings are fine with a BOM that has the same endianness
+    int bom_matches = bom == reader->encoding
+        || (TPENC_IS_UTF16(bom) && reader->encoding == TPENC_UTF16 && textprocessing_is_big_endian(bom) == textprocessing_is_big_endian(TPENC_UTF16))
+        || (TPENC_IS_UTF32(bom) && reader->encoding == TPENC_UTF32 && textprocessing_is_big_endian(bom) == textprocessing_is_big_endian(TPENC_UTF32));
+
+    // the enum has no negative values so it can be unsigned, the -1/-2 from check_bom have to be compared as ints
+    if ((int)bom >= 0 && (bom_matches || reader->encoding == (textprocessing_encoding_t)-1))
     {
-        reader->encoding = bom;
-        if (reader->encoding & TPENC_UTF16)
-            reader->text_start_offset = 2;
-        else
-            reader->text_start_offset = 3;
+        if (reader->encoding == (textprocessing_encoding_t)-1)
+            reader->encoding = bom;
+
+        reader->text_start_offset = bom == TPENC_UTF8 ? 3 : textprocessing_unit_size(bom);
     }
+    // without a BOM there's no way to tell so just go with utf-8
+    if (reader->encoding == (textprocessing_encoding_t)-1)
+        reader->encoding = TPENC_UTF8;
 
     if (textreader_seek(reader, 0, TRSEEK_TEXT_SET) != 0)
     {
-        textreader_close(reader, -1);
+        reader->flags |= TRFLG_ERROR;
+        return -1;
+    }
+    return 0;
+}
+
+static void *textreader_pool_get_pushback(textreader_pool_t *pool)
+{
+    if (pool->free_pushback == NULL)
+    {
+        // allocate a whole slab of buffers at once, the first pointer sized bytes links the slabs together
+        size_t header = (sizeof(void*) + 15) & ~(size_t)15;
+        char *slab = malloc(header + (size_t)TEXTREADER_POOL_PUSHBACK_SLAB_COUNT * TEXTREADER_PUSHBACK_BUFFER_SIZE);
+        if (slab == NULL)
+            return NULL;
+
+        *(void**)slab = pool->pushback_slabs;
+        pool->pushback_slabs = slab;
+        for (int i = 0; i < TEXTREADER_POOL_PUSHBACK_SLAB_COUNT; ++i)
+        {
+            void *buf = slab + header + (size_t)i * TEXTREADER_PUSHBACK_BUFFER_SIZE;
+            *(void**)buf = pool->free_pushback;
+            pool->free_pushback = buf;
+        }
+    }
+    void *buf = pool->free_pushback;
+    pool->free_pushback = *(void**)buf;
+    return buf;
+}
+
+static int textreader_alloc_pushback(textreader_t *reader)
+{
+    if (reader->ungetc_stack.buffer != NULL)
+        return 0;
+
+    if (reader->pool != NULL)
+        reader->ungetc_stack.buffer = textreader_pool_get_pushback(reader->pool);
+    else
+        reader->ungetc_stack.buffer = malloc(TEXTREADER_PUSHBACK_BUFFER_SIZE);
+
+    return reader->ungetc_stack.buffer == NULL ? -1 : 0;
+}
+
+static void textreader_free_pushback(textreader_t *reader)
+{
+    if (reader->ungetc_stack.buffer == NULL)
+        return;
+
+    if (reader->pool != NULL)
+    {
+        *(void**)reader->ungetc_stack.buffer = reader->pool->free_pushback;
+        reader->pool->free_pushback = reader->ungetc_stack.buffer;
+    }
+    else free(reader->ungetc_stack.buffer);
+
+    reader->ungetc_stack.buffer = NULL;
+    reader->ungetc_stack.size = 0;
+}
+
+#ifdef TEXTREADER_HAVE_PREAD
+// reads len bytes at offset, returns how many it got (less than len only at the end of the file) or -1
+static ssize_t textreader_prefetch_pread(int fd, uint8_t *buffer, size_t len, off_t offset)
+{
+    size_t got = 0;
+    while (got < len)
+    {
+        ssize_t rv = pread(fd, buffer + got, len - got, offset + (off_t)got);
+        if (rv < 0 && errno == EINTR)
+            continue;
+
+        if (rv < 0)
+            return -1;
+
+        if (rv == 0)
+            break;
+
+        got += rv;
+    }
+    return (ssize_t)got;
+}
+
+static void textreader_prefetch_fill_ahead(struct textreader_prefetch_state *state)
+{
+    int ahead = !state->current;
+    #ifdef POSIX_FADV_WILLNEED
+    posix_fadvise(state->fd, state->offsets[ahead] + TEXTREADER_PREFETCH_BLOCK_SIZE, TEXTREADER_PREFETCH_BLOCK_SIZE, POSIX_FADV_WILLNEED);
+    #endif
+    ssize_t got = textreader_prefetch_pread(state->fd, state->buffers[ahead], TEXTREADER_PREFETCH_BLOCK_SIZE, state->offsets[ahead]);
+    state->ahead_error = got < 0;
+    state->lens[ahead] = got < 0 ? 0 : (size_t)got;
+}
+
+#ifdef TEXTREADER_HAVE_THREADS
+static void *textreader_prefetch_thread(void *arg)
+{
+    struct textreader_prefetch_state *state = arg;
+    pthread_mutex_lock(&state->lock);
+    for (;;)
+    {
+        while (!state->requested && !state->stop)
+            pthread_cond_wait(&state->cond, &state->lock);
+
+        if (state->stop)
+            break;
+
+        // the reader doesn't touch the other buffer until requested is cleared
+        pthread_mutex_unlock(&state->lock);
+        textreader_prefetch_fill_ahead(state);
+        pthread_mutex_lock(&state->lock);
+        state->requested = 0;
+        pthread_cond_broadcast(&state->cond);
+    }
+    pthread_mutex_unlock(&state->lock);
+    return NULL;
+}
+
+// waits until the helper isn't reading anything
+static void textreader_prefetch_idle(struct textreader_prefetch_state *state)
+{
+    pthread_mutex_lock(&state->lock);
+    while (state->requested)
+        pthread_cond_wait(&state->cond, &state->lock);
+
+    pthread_mutex_unlock(&state->lock);
+}
+#endif
+
+// starts getting the block after the current buffer into the other one, if the current one isn't the last block
+static void textreader_prefetch_request(struct textreader_prefetch_state *state)
+{
+    state->ahead_valid = 0;
+    if (state->lens[state->current] < TEXTREADER_PREFETCH_BLOCK_SIZE)
+        return;
+
+    state->offsets[!state->current] = state->offsets[state->current] + TEXTREADER_PREFETCH_BLOCK_SIZE;
+    state->ahead_valid = 1;
+    #ifdef TEXTREADER_HAVE_THREADS
+    pthread_mutex_lock(&state->lock);
+    state->requested = 1;
+    pthread_cond_broadcast(&state->cond);
+    pthread_mutex_unlock(&state->lock);
+    #else
+    #ifdef POSIX_FADV_WILLNEED
+    posix_fadvise(state->fd, state->offsets[!state->current], TEXTREADER_PREFETCH_BLOCK_SIZE, POSIX_FADV_WILLNEED);
+    #endif
+    #endif
+}
+
+// reads the block at offset into the current buffer right away (used at the start and after seeks)
+static int textreader_prefetch_load(textreader_t *reader, off_t offset)
+{
+    struct textreader_prefetch_state *state = reader->prefetch;
+    #ifdef TEXTREADER_HAVE_THREADS
+    textreader_prefetch_idle(state);
+    #endif
+    ssize_t got = textreader_prefetch_pread(state->fd, state->buffers[state->current], TEXTREADER_PREFETCH_BLOCK_SIZE, offset);
+    if (got < 0)
+    {
+        state->lens[state->current] = 0;
+        state->window.size = 0;
+        state->window.index = 0;
+        state->ahead_valid = 0;
+        reader->flags |= TRFLG_ERROR;
+        return -1;
+    }
+    state->offsets[state->current] = offset;
+    state->lens[state->current] = got;
+    state->window.size = got;
+    state->window.index = 0;
+    textreader_prefetch_request(state);
+    return 0;
+}
+
+// moves on to the next buffer once the current one has been decoded, returns -1 at the end of the file or on error
+static int textreader_prefetch_next(textreader_t *reader)
+{
+    struct textreader_prefetch_state *state = reader->prefetch;
+    if (!state->ahead_valid)
+    {
+        reader->flags |= TRFLG_EOF;
+        return -1;
+    }
+    #ifdef TEXTREADER_HAVE_THREADS
+    textreader_prefetch_idle(state);
+    #else
+    textreader_prefetch_fill_ahead(state);
+    #endif
+    if (state->ahead_error)
+    {
+        state->ahead_valid = 0;
+        reader->flags |= TRFLG_ERROR;
+        return -1;
+    }
+    state->current = !state->current;
+    state->window.data = state->buffers[state->current];
+    state->window.size = state->lens[state->current];
+    state->window.index = 0;
+    textreader_prefetch_request(state);
+    if (state->window.size == 0)
+    {
+        reader->flags |= TRFLG_EOF;
+        return -1;
+    }
+    return 0;
+}
+
+static off_t textreader_prefetch_tell(textreader_t *reader)
+{
+    struct textreader_prefetch_state *state = reader->prefetch;
+    return state->offsets[state->current] + (off_t)state->window.index;
+}
+
+static int textreader_prefetch_seek(textreader_t *reader, off_t pos, int whence)
+{
+    struct textreader_prefetch_state *state = reader->prefetch;
+    if (whence == SEEK_CUR)
+        pos += textreader_prefetch_tell(reader);
+    else if (whence == SEEK_END)
+    {
+        struct stat st;
+        if (fstat(state->fd, &st) != 0)
+            return -1;
+
+        pos += st.st_size;
+    }
+    if (pos < 0)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    reader->flags &= ~TRFLG_EOF;
+    // seeking inside of the current block doesn't need any reading
+    off_t start = state->offsets[state->current];
+    if (pos >= start && pos <= start + (off_t)state->window.size)
+    {
+        state->window.index = pos - start;
+        return 0;
+    }
+    return textreader_prefetch_load(reader, pos);
+}
+
+static void textreader_prefetch_free(struct textreader_prefetch_state *state)
+{
+    free(state->buffers[0]);
+    free(state);
+}
+
+int textreader_prefetch(textreader_t *reader, int enable)
+{
+    struct textreader_prefetch_state *state = reader->prefetch;
+    if (!enable)
+    {
+        if (state == NULL)
+            return 0;
+
+        #ifdef TEXTREADER_HAVE_THREADS
+        pthread_mutex_lock(&state->lock);
+        state->stop = 1;
+        pthread_cond_broadcast(&state->cond);
+        pthread_mutex_unlock(&state->lock);
+        pthread_join(state->thread, NULL);
+        pthread_mutex_destroy(&state->lock);
+        pthread_cond_destroy(&state->cond);
+        #endif
+        // the FILE carries on from where the reader is
+        off_t pos = textreader_prefetch_tell(reader);
+        reader->prefetch = NULL;
+        reader->window = NULL;
+        reader->flags &= ~(TRFLG_PREFETCH | TRFLG_EOF);
+        textreader_prefetch_free(state);
+        return fseeko(reader->data.file, pos, SEEK_SET);
+    }
+    if (state != NULL)
+        return 0;
+
+    // the FILE could have characters pushed back into it and follow mode needs the FILE to see the end of the file
+    struct stat st;
+    if ((reader->flags & (TRFLG_ISMEM | TRFLG_FOLLOW | TRFLG_USE_FGETWC)) || reader->total_ungetc_count != 0
+        || fstat(fileno(reader->data.file), &st) != 0 || !S_ISREG(st.st_mode))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    off_t pos = ftello(reader->data.file);
+    if (pos < 0)
+        return -1;
+
+    state = calloc(1, sizeof(struct textreader_prefetch_state));
+    uint8_t *buffers = malloc(2 * (size_t)TEXTREADER_PREFETCH_BLOCK_SIZE);
+    if (state == NULL || buffers == NULL)
+    {
+        free(state);
+        free(buffers);
+        errno = ENOMEM;
+        return -1;
+    }
+    state->fd = fileno(reader->data.file);
+    state->buffers[0] = buffers;
+    state->buffers[1] = buffers + TEXTREADER_PREFETCH_BLOCK_SIZE;
+    state->window.data = buffers;
+    // if the first block can't be read, disabling it again puts the FILE back here
+    state->offsets[state->current] = pos;
+    #ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(state->fd, pos, 0, POSIX_FADV_SEQUENTIAL);
+    #endif
+    #ifdef TEXTREADER_HAVE_THREADS
+    pthread_mutex_init(&state->lock, NULL);
+    pthread_cond_init(&state->cond, NULL);
+    if (pthread_create(&state->thread, NULL, textreader_prefetch_thread, state) != 0)
+    {
+        pthread_mutex_destroy(&state->lock);
+        pthread_cond_destroy(&state->cond);
+        textreader_prefetch_free(state);
+        errno = EAGAIN;
+        return -1;
+    }
+    #endif
+    reader->prefetch = state;
+    reader->window = &state->window;
+    reader->flags |= TRFLG_PREFETCH;
+    if (textreader_prefetch_load(reader, pos) != 0)
+    {
+        textreader_prefetch(reader, 0);
+        reader->flags |= TRFLG_ERROR;
         return -1;
     }
     return 0;
 }
+#else
+// TRFLG_PREFETCH never gets set without pread
+static off_t textreader_prefetch_tell(textreader_t *reader)
+{
+    (void)reader;
+    return -1;
+}
+
+static int textreader_prefetch_seek(textreader_t *reader, off_t pos, int whence)
+{
+    (void)reader;
+    (void)pos;
+    (void)whence;
+    return -1;
+}
+
+int textreader_prefetch(textreader_t *reader, int enable)
+{
+    // there's no pread to read the blocks with, the FILE's own buffering is used
+    (void)reader;
+    if (!enable)
+        return 0;
+
+    errno = ENOSYS;
+    return -1;
+}
+#endif
 
 // gets a single byte to be decoded
 int textreader_get_byte(textreader_t *reader)
 {
     if (reader->ungetc_stack.size > 0)
-        return reader->ungetc_stack.buffer[--reader->ungetc_stack.size];
+    {
+        int c = (unsigned char)reader->ungetc_stack.buffer[--reader->ungetc_stack.size];
+        // pooled readers give the buffer back right away so it can be used by the other readers
+        if (reader->ungetc_stack.size == 0 && reader->pool != NULL)
+            textreader_free_pushback(reader);
+
+        return c;
+    }
 
     if ((reader->flags & TRFLG_ISMEM) == 0)
     {
+        #ifdef TEXTREADER_HAVE_PREAD
+        if (reader->flags & TRFLG_PREFETCH)
+        {
+            struct textreader_prefetch_state *state = reader->prefetch;
+            if (state->window.index < state->window.size || textreader_prefetch_next(reader) == 0)
+                return state->window.data[state->window.index++];
+
+            return EOF;
+        }
+        #endif
         // This exists so that I can easily get unicode stdin input on Windows.
         // Couldn't find a way to get unicode input without fgetwc on Windows.
         if (reader->flags & TRFLG_USE_FGETWC && reader->total_ungetc_count == 0)
@@ -238,10 +704,16 @@ int textreader_get_byte(textreader_t *reader)
                                                                      \
         if ((reader->flags & TRFLG_ISMEM) == 0)                      \
         {                                                            \
-            int rv = fseek_fname(reader->data.file, pos, whence);    \
+            int rv = (reader->flags & TRFLG_PREFETCH)                \
+                ? textreader_prefetch_seek(reader, pos, whence)      \
+                : fseek_fname(reader->data.file, pos, whence);       \
             if (rv != EOF)                                           \
+            {                                                        \
                 reader->ungetc_stack.size = 0;                       \
-                                                                     \
+                reader->total_ungetc_count = 0;                      \
+                if (reader->flags & TRFLG_TRACK_POSITION)            \
+                    textreader_position_after_seek(reader);          \
+            }                                                        \
             return rv;                                               \
         }                                                            \
                                                                      \
@@ -263,12 +735,14 @@ int textreader_get_byte(textreader_t *reader)
             if (pos < 0 && -pos > reader->data.mem.size)             \
                 return -1;                                           \
                                                                      \
-            reader->data.mem.size += pos;                            \
+            reader->data.mem.index = reader->data.mem.size + pos;    \
             break;                                                   \
         }                                                            \
-        reader->flags ^= TRFLG_EOF;                                  \
+        reader->flags &= ~TRFLG_EOF;                                 \
         reader->ungetc_stack.size = 0;                               \
         reader->total_ungetc_count = 0;                              \
+        if (reader->flags & TRFLG_TRACK_POSITION)                    \
+            textreader_position_after_seek(reader);                  \
         return 0;                                                    \
     }                                                                \
                                                                      \
@@ -277,6 +751,9 @@ int textreader_get_byte(textreader_t *reader)
         if (reader->ungetc_stack.size > 0)                           \
             return EOF;                                              \
                                                                      \
+        if (reader->flags & TRFLG_PREFETCH)                          \
+            return (offset_type)textreader_prefetch_tell(reader);    \
+                                                                     \
         if ((reader->flags & TRFLG_ISMEM) == 0)                      \
             return ftell_fname(reader->data.file);                   \
                                                                      \
@@ -338,7 +815,7 @@ long textreader_tell(textreader_t *reader)
 
 int textreader_eof(textreader_t *reader)
 {
-    if ((reader->flags & TRFLG_ISMEM) == 0)
+    if ((reader->flags & (TRFLG_ISMEM | TRFLG_PREFETCH)) == 0)
         return feof(reader->data.file);
 
     return reader->flags & TRFLG_EOF;
@@ -346,12 +823,21 @@ int textreader_eof(textreader_t *reader)
 
 int textreader_error(textreader_t *reader)
 {
-    if ((reader->flags & TRFLG_ISMEM) == 0)
-        return ferror(reader->data.file);
+    // decoding errors only set the flag, even for files
+    if ((reader->flags & TRFLG_ISMEM) == 0 && ferror(reader->data.file))
+        return 1;
 
     return reader->flags & TRFLG_ERROR;
 }
 
+size_t textreader_invalid_count(textreader_t *reader, off_t *first_error_offset)
+{
+    if (first_error_offset != NULL)
+        *first_error_offset = reader->error_count > 0 ? reader->first_error_offset : -1;
+
+    return reader->error_count;
+}
+
 int textreader_ungetc(textreader_t *reader, int32_t chr)
 {
     if (TEXTREADER_PUSHBACK_BUFFER_SIZE - reader->ungetc_stack.size < 4)
@@ -365,7 +851,7 @@ int textreader_ungetc(textreader_t *reader, int32_t chr)
     int successfully_ungetcd = 0;
     // If it's a file, ungetc what it can to the file
     // And then ungetc it into the buffer textreader buffer so 0 memory wasted :DDDDDDDd
-    if ((reader->flags & TRFLG_ISMEM) == 0 && reader->ungetc_stack.size == 0)
+    if ((reader->flags & (TRFLG_ISMEM | TRFLG_PREFETCH)) == 0 && reader->ungetc_stack.size == 0)
     {
         for (; successfully_ungetcd < ungetcd_len; ++successfully_ungetcd)
         {
@@ -373,140 +859,1458 @@ int textreader_ungetc(textreader_t *reader, int32_t chr)
                 break;
         }
     }
+    if (successfully_ungetcd < ungetcd_len && textreader_alloc_pushback(reader) != 0)
+    {
+        errno = ENOMEM;
+        return EOF;
+    }
     for (; successfully_ungetcd < ungetcd_len; ++successfully_ungetcd)
         reader->ungetc_stack.buffer[reader->ungetc_stack.size++] = ungetcd[ungetcd_len - successfully_ungetcd - 1];
 
     ++reader->total_ungetc_count;
     reader->flags &= ~TRFLG_EOF;
+    if (reader->flags & TRFLG_TRACK_POSITION)
+        textreader_position_unconsume(reader, chr, textreader_source_len(reader->encoding, chr));
+
     return 0;
 }
 
-int32_t textreader_getc(textreader_t *reader)
+// puts a byte that was read by textreader_get_byte back without treating it as an ungetc'd character
+static int textreader_unget_byte(textreader_t *reader, int c)
 {
-    reader->flags &= ~TRFLG_EOF;
-    int enc = reader->total_ungetc_count == 0 ? reader->encoding : TPENC_UTF8;
-    int32_t rslt = 0;
-    switch (enc)
+    if ((reader->flags & TRFLG_ISMEM) && reader->ungetc_stack.size == 0)
     {
-    case TPENC_ASCII:
-        rslt = textreader_get_byte(reader);
-        break;
-    case TPENC_UTF16BE:
-    case TPENC_UTF16LE:
-    case TPENC_UTF16:
-        {
-            int multiple_nums = 0;
-            for (int i = 0; i < 2; ++i)
-            {
-                uint16_t curchr = 0;
-                for (int l = 0; l < 2; ++l)
-                {
-                    int c = textreader_get_byte(reader);
-                    if (c == EOF)
-                    {
-                        if (textreader_eof(reader) && i != 0 && l != 0)
-                        {
-                            errno = EILSEQ;
-                            reader->flags |= TRFLG_ERROR;
-                        }
-                        return EOF;
-                    }
-                    if (enc == TPENC_UTF16)
-                    {
-                        ((uint8_t*)&curchr)[l] = c;
-                    }
-                    else
-                    {
-                        int offset_byte = (enc == TPENC_UTF16BE ? 1-l : l);
-                        curchr |= c << (offset_byte * 8);
-                    }
-                }
-                if (i == 0 && !(multiple_nums = ((curchr & (0x3f << 10)) == 0xd800)))
-                {
-                    rslt = curchr;
-                    break;
-                }
-                else if (i == 1 && (curchr & (0x3f << 10)) != 0xdc00)
-                {
-                    errno = EILSEQ;
-                    reader->flags |= TRFLG_ERROR;
-                    return EOF;
-                }
-                rslt |= ((curchr & 0x3ff) << ((1-i) * 10));
-            }
-            // this really caused me a lot of trouble
-            // because i did not frickin realize that i was supposed to do this
-            if (multiple_nums)
-                rslt += 0x10000;
-        }
-        break;
-    case TPENC_UTF8:
-        {
-            int c = textreader_get_byte(reader);
-            // printf("\nGot byte: %02x\n", c);
-            if (c == EOF)
-                return EOF;
-
-            int byte_count = 0;
-            for (; (c & (1 << (7-byte_count))) != 0; ++byte_count);
-            if (byte_count == 0)
-            {
-                rslt = c;
-                break;
-            }
-            int bits = 7-byte_count;
-            rslt |= ((uint8_t)c & N_BIT_ON(bits)) << 6;
-            --byte_count;
-            //printf("Bits = %i; byte_count = %i; n = %02x\n", bits, byte_count, ((uint8_t)c & N_BIT_ON(bits)) << bits);
-            for (int i = 0; i < byte_count; ++i)
-            {
-                if ((c = textreader_get_byte(reader)) == EOF)
-                {
-                    if (textreader_eof(reader))
-                    {
-                        errno = EILSEQ;
-                        reader->flags |= TRFLG_ERROR;
-                    }
+        --reader->data.mem.index;
+        return 0;
+    }
+    #ifdef TEXTREADER_HAVE_PREAD
+    if ((reader->flags & TRFLG_PREFETCH) && reader->ungetc_stack.size == 0 && reader->prefetch->window.index > 0)
+    {
+        --reader->prefetch->window.index;
+        return 0;
+    }
+    #endif
+    if (textreader_alloc_pushback(reader) != 0 || reader->ungetc_stack.size >= TEXTREADER_PUSHBACK_BUFFER_SIZE)
+        return EOF;
 
-                    return EOF;
-                }
-                // printf("Got byte: %02x\n", c);
-                if ((c & 0xc0) != 0x80)
-                {
-                    errno = EILSEQ;
-                    reader->flags |= TRFLG_ERROR;
-                    return EOF;
-                }
-                if (i > 0)
-                    rslt <<= 6;
+    reader->ungetc_stack.buffer[reader->ungetc_stack.size++] = c;
+    return 0;
+}
 
-                rslt |= ((int32_t)(c & 0x7f));
-                bits += 7;
-            }
-        }
-        break;
-    default:
-        errno = EINVAL;
+// called when the decoder finds an ill-formed sequence that is byte_count bytes long
+// (the byte that made it ill-formed isn't included, it's put back and decoded again on the next call)
+static int32_t textreader_invalid_sequence(textreader_t *reader, int byte_count)
+{
+    if ((reader->flags & TRFLG_REPLACE_INVALID) == 0)
+    {
+        errno = EILSEQ;
+        reader->flags |= TRFLG_ERROR;
         return EOF;
     }
-    if (reader->total_ungetc_count)
-        --reader->total_ungetc_count;
-
-    return rslt;
+    if (reader->error_count++ == 0)
+    {
+        if (reader->flags & TRFLG_TRACK_POSITION)
+            reader->first_error_offset = reader->position->pos.byte_offset;
+        else
+            reader->first_error_offset = textreader_source_offset(reader) - (off_t)reader->ungetc_stack.size - byte_count;
+    }
+    // the EOF flag could've been set by a sequence that got cut off by the end of the text
+    // but there's still a character to return
+    reader->flags &= ~TRFLG_EOF;
+    return TEXTREADER_REPLACEMENT_CHARACTER;
 }
 
-void textreader_clearerr(textreader_t *reader)
+// called when the data ends in the middle of a sequence, count bytes of it were read
+// in follow mode they're put back so they get decoded again once the rest of the sequence has been written
+static int32_t textreader_cut_off(textreader_t *reader, const uint8_t *bytes, int count)
 {
-    if ((reader->flags & TRFLG_ISMEM) == 0)
-        clearerr(reader->data.file);
+    if ((reader->flags & TRFLG_FOLLOW) == 0)
+        return textreader_invalid_sequence(reader, count);
 
-    reader->flags &= ~TRFLG_ERROR;
+    for (int i = count; i-- > 0;)
+    {
+        if (textreader_unget_byte(reader, bytes[i]) != 0)
+        {
+            errno = ENOMEM;
+            reader->flags |= TRFLG_ERROR;
+            return EOF;
+        }
+    }
+    return EOF;
 }
 
-int textreader_close(textreader_t *reader, int close_file)
+int textreader_drop_cut_off(textreader_t *reader)
 {
-    if ((reader->flags & TRFLG_ISMEM) == 0 && (close_file || !(reader->flags & TRFLG_IS_INIT_FILEPTR)))
-        return fclose(reader->data.file);
+    // the cut off bytes are the only thing in the pushback if no characters were ungetc'd after them
+    if (reader->ungetc_stack.size == 0 || reader->total_ungetc_count != 0)
+        return 0;
 
-    return 0;
+    int count = (int)reader->ungetc_stack.size;
+    reader->ungetc_stack.size = 0;
+    return textreader_invalid_sequence(reader, count) == EOF ? -1 : 0;
+}
+
+static void textreader_unit16_bytes(textprocessing_encoding_t enc, uint16_t unit, uint8_t *bytes)
+{
+    if (enc == TPENC_UTF16)
+        memcpy(bytes, &unit, 2);
+    else
+    {
+        int high = enc == TPENC_UTF16BE ? 0 : 1;
+        bytes[high] = unit >> 8;
+        bytes[1-high] = unit & 0xff;
+    }
+}
+
+// reads a single utf-16 unit, returns how many bytes it got (0, 1 or 2)
+static int textreader_get_unit16(textreader_t *reader, textprocessing_encoding_t enc, uint16_t *unit, int *last_byte)
+{
+    *unit = 0;
+    for (int l = 0; l < 2; ++l)
+    {
+        int c = textreader_get_byte(reader);
+        if (c == EOF)
+            return l;
+
+        *last_byte = c;
+        if (enc == TPENC_UTF16)
+            ((uint8_t*)unit)[l] = c;
+        else
+            *unit |= c << ((enc == TPENC_UTF16BE ? 1-l : l) * 8);
+    }
+    return 2;
+}
+
+static int32_t textreader_decode_utf16(textreader_t *reader, textprocessing_encoding_t enc, int *byte_count)
+{
+    uint16_t first, second;
+    int first_byte;
+    int got = textreader_get_unit16(reader, enc, &first, &first_byte);
+    *byte_count = got;
+    if (got == 0)
+        return EOF;
+
+    if (got == 1)
+    {
+        uint8_t byte = first_byte;
+        return textreader_eof(reader) ? textreader_cut_off(reader, &byte, 1) : EOF;
+    }
+
+    if ((first & 0xfc00) == 0xdc00)
+        return textreader_invalid_sequence(reader, 2);
+
+    if ((first & 0xfc00) != 0xd800)
+        return first;
+
+    int last_byte = 0;
+    got = textreader_get_unit16(reader, enc, &second, &last_byte);
+    if (got == 2 && (second & 0xfc00) == 0xdc00)
+    {
+        *byte_count = 4;
+        return ((((int32_t)first & 0x3ff) << 10) | (second & 0x3ff)) + 0x10000;
+    }
+    if (got < 2 && !textreader_eof(reader))
+        return EOF;
+
+    if (got < 2 && (reader->flags & TRFLG_FOLLOW))
+    {
+        uint8_t bytes[3];
+        textreader_unit16_bytes(enc, first, bytes);
+        bytes[2] = last_byte;
+        return textreader_cut_off(reader, bytes, 2 + got);
+    }
+
+    // the high surrogate is on its own, so the unit after it is decoded again on the next call
+    if (got == 2)
+    {
+        uint8_t bytes[2];
+        textreader_unit16_bytes(enc, second, bytes);
+        textreader_unget_byte(reader, bytes[1]);
+        textreader_unget_byte(reader, bytes[0]);
+    }
+    else if (got == 1)
+        textreader_unget_byte(reader, last_byte);
+
+    return textreader_invalid_sequence(reader, 2);
+}
+
+static int32_t textreader_decode_utf32(textreader_t *reader, textprocessing_encoding_t enc, int *byte_count)
+{
+    uint8_t bytes[4];
+    int is_be = textprocessing_is_big_endian(enc);
+    *byte_count = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        int c = textreader_get_byte(reader);
+        if (c == EOF)
+        {
+            if (i == 0 || !textreader_eof(reader))
+                return EOF;
+
+            return textreader_cut_off(reader, bytes, i);
+        }
+        bytes[i] = c;
+        ++*byte_count;
+    }
+    uint32_t rslt = 0;
+    for (int i = 0; i < 4; ++i)
+        rslt |= (uint32_t)bytes[is_be ? 3-i : i] << (i * 8);
+
+    if (rslt > 0x10ffff || (rslt & 0xfffff800) == 0xd800)
+        return textreader_invalid_sequence(reader, 4);
+
+    return (int32_t)rslt;
+}
+
+/*
+ *  decodes utf-8 according to table 3-7 of the unicode standard (well-formed utf-8 byte sequences)
+ *  the allowed range of the second byte depends on the first byte, which is how overlong forms,
+ *  surrogates and code points above U+10FFFF are rejected
+ *
+ *  on an ill-formed sequence, the bytes that were still a valid prefix (the maximal subpart)
+ *  become a single replacement character and the byte that broke it is left to be read again
+ */
+static int32_t textreader_decode_utf8(textreader_t *reader, int *byte_count)
+{
+    int c = textreader_get_byte(reader);
+    *byte_count = 1;
+    if (c == EOF)
+    {
+        *byte_count = 0;
+        return EOF;
+    }
+    if (c < 0x80)
+        return c;
+
+    uint8_t bytes[4] = { c };
+    int need;
+    int lower = 0x80, upper = 0xbf;
+    int32_t rslt;
+    if (c >= 0xc2 && c <= 0xdf)
+    {
+        need = 1;
+        rslt = c & N_BIT_ON(5);
+    }
+    else if (c >= 0xe0 && c <= 0xef)
+    {
+        need = 2;
+        rslt = c & N_BIT_ON(4);
+        if (c == 0xe0)
+            lower = 0xa0;
+        else if (c == 0xed)
+            upper = 0x9f;
+    }
+    else if (c >= 0xf0 && c <= 0xf4)
+    {
+        need = 3;
+        rslt = c & N_BIT_ON(3);
+        if (c == 0xf0)
+            lower = 0x90;
+        else if (c == 0xf4)
+            upper = 0x8f;
+    }
+    else return textreader_invalid_sequence(reader, 1);
+
+    for (int i = 0; i < need; ++i)
+    {
+        if ((c = textreader_get_byte(reader)) == EOF)
+        {
+            if (textreader_eof(reader))
+                return textreader_cut_off(reader, bytes, *byte_count);
+
+            return EOF;
+        }
+        if (c < lower || c > upper)
+        {
+            textreader_unget_byte(reader, c);
+            return textreader_invalid_sequence(reader, *byte_count);
+        }
+        lower = 0x80;
+        upper = 0xbf;
+        rslt = (rslt << 6) | (c & N_BIT_ON(6));
+        bytes[(*byte_count)++] = c;
+    }
+    return rslt;
+}
+
+static int32_t textreader_decode(textreader_t *reader, int *byte_count)
+{
+    reader->flags &= ~TRFLG_EOF;
+    int enc = reader->total_ungetc_count == 0 ? reader->encoding : TPENC_UTF8;
+    int32_t rslt = 0;
+    switch (enc)
+    {
+    case TPENC_ASCII:
+        rslt = textreader_get_byte(reader);
+        *byte_count = 1;
+        if (rslt >= 0x80)
+            rslt = textreader_invalid_sequence(reader, 1);
+
+        break;
+    case TPENC_LATIN1:
+        rslt = textreader_get_byte(reader);
+        *byte_count = 1;
+        break;
+    case TPENC_CP1252:
+        rslt = textreader_get_byte(reader);
+        *byte_count = 1;
+        if (rslt >= 0x80 && rslt < 0xa0)
+            rslt = textprocessing_cp1252_c1_table[rslt - 0x80];
+
+        break;
+    case TPENC_UTF32BE:
+    case TPENC_UTF32LE:
+    case TPENC_UTF32:
+        rslt = textreader_decode_utf32(reader, enc, byte_count);
+        break;
+    case TPENC_UTF16BE:
+    case TPENC_UTF16LE:
+    case TPENC_UTF16:
+        rslt = textreader_decode_utf16(reader, enc, byte_count);
+        break;
+    case TPENC_UTF8:
+        rslt = textreader_decode_utf8(reader, byte_count);
+        break;
+    default:
+        errno = EINVAL;
+        return EOF;
+    }
+    if (rslt != EOF && reader->total_ungetc_count)
+        --reader->total_ungetc_count;
+
+    return rslt;
+}
+
+// how many bytes the character takes in the reader's encoding
+static int textreader_source_len(textprocessing_encoding_t enc, int32_t chr)
+{
+    if (TPENC_IS_UTF32(enc))
+        return 4;
+
+    if (TPENC_IS_UTF16(enc))
+        return chr > 0xffff ? 4 : 2;
+
+    if (enc != TPENC_UTF8 || chr < 0x80)
+        return 1;
+
+    return chr < 0x800 ? 2 : chr < 0x10000 ? 3 : 4;
+}
+
+// finds the next '\n' in [p, end), base is where the block of text starts so it knows where the code units start
+static const uint8_t *textreader_find_newline(textprocessing_encoding_t enc, const uint8_t *base, const uint8_t *p, const uint8_t *end)
+{
+    int unit = textprocessing_unit_size(enc);
+    if (unit == 1)
+        return memchr(p, '\n', end - p);
+
+    // the '\n' byte is the last byte of the unit for big endian and the first one for little endian
+    size_t nl_index = textprocessing_is_big_endian(enc) ? unit - 1 : 0;
+    // memchr is still used to find the candidates, most of them should be actual newlines anyways
+    while (p < end)
+    {
+        const uint8_t *nl = memchr(p, '\n', end - p);
+        if (nl == NULL)
+            return NULL;
+
+        const uint8_t *unit_start = nl - nl_index;
+        if ((size_t)(nl - base) % unit == nl_index && unit_start + unit <= end)
+        {
+            int zeros = 1;
+            for (int i = 0; i < unit; ++i)
+                zeros &= (size_t)i == nl_index || unit_start[i] == 0;
+
+            if (zeros)
+                return unit_start;
+        }
+        p = nl + 1;
+    }
+    return NULL;
+}
+
+/*
+ *  counts the characters the decoder makes out of a block, so ill-formed text gets the same columns as when it's read:
+ *  every maximal subpart of an ill-formed utf-8 sequence and every unpaired surrogate is one U+FFFD
+ *  a character that the block splits in half is carried over to the next block in the state,
+ *  a cut off utf-16/32 unit can only be at the end of the text, where it's one U+FFFD too
+ */
+static size_t textreader_count_code_points(struct textreader_position_state *state, textprocessing_encoding_t enc, const uint8_t *p, const uint8_t *end)
+{
+    size_t count = 0;
+    if (TPENC_IS_UTF32(enc))
+        return (end - p + 3) / 4;
+
+    if (TPENC_IS_UTF16(enc))
+    {
+        // the high byte of the unit tells whether it's a surrogate, a low one only counts if it isn't part of a pair
+        int high = textprocessing_is_big_endian(enc) ? 0 : 1;
+        size_t len = (end - p) / 2;
+        int after_high = state->pending;
+        count += (end - p) % 2;
+        for (size_t i = 0; i < len; ++i)
+        {
+            uint8_t bits = p[i*2 + high] & 0xfc;
+            count += bits != 0xdc || !after_high;
+            after_high = bits == 0xd8;
+        }
+        state->pending = after_high;
+        return count;
+    }
+    if (enc != TPENC_UTF8)
+        return end - p;
+
+    // the same byte ranges as textreader_decode_utf8, a byte that doesn't continue the sequence starts a new character
+    size_t len = end - p;
+    size_t i = 0;
+    int pending = state->pending;
+    uint8_t lower = state->lower, upper = state->upper;
+    while (i < len)
+    {
+        if (pending == 0)
+        {
+            size_t ascii_start = i;
+            while (i < len && p[i] < 0x80)
+                ++i;
+
+            count += i - ascii_start;
+            if (i == len)
+                break;
+        }
+        uint8_t c = p[i++];
+        if (pending > 0 && c >= lower && c <= upper)
+        {
+            --pending;
+            lower = 0x80;
+            upper = 0xbf;
+            continue;
+        }
+        ++count;
+        pending = 0;
+        lower = 0x80;
+        upper = 0xbf;
+        if (c >= 0xc2 && c <= 0xdf)
+            pending = 1;
+        else if (c >= 0xe0 && c <= 0xef)
+        {
+            pending = 2;
+            if (c == 0xe0)
+                lower = 0xa0;
+            else if (c == 0xed)
+                upper = 0x9f;
+        }
+        else if (c >= 0xf0 && c <= 0xf4)
+        {
+            pending = 3;
+            if (c == 0xf0)
+                lower = 0x90;
+            else if (c == 0xf4)
+                upper = 0x8f;
+        }
+    }
+    state->pending = pending;
+    state->lower = lower;
+    state->upper = upper;
+    return count;
+}
+
+static void textreader_position_push_line_end(struct textreader_position_state *state, size_t column)
+{
+    state->line_end_columns[state->line_end_next] = column;
+    state->line_end_next = (state->line_end_next + 1) % TEXTREADER_POSITION_HISTORY;
+    if (state->line_end_count < TEXTREADER_POSITION_HISTORY)
+        ++state->line_end_count;
+}
+
+// moves the position forward over a block of encoded text
+static void textreader_position_advance(struct textreader_position_state *state, textprocessing_encoding_t enc, const uint8_t *block, size_t len)
+{
+    const uint8_t *end = block + len;
+    const uint8_t *line_start = block;
+    const uint8_t *nl;
+    int unit = textprocessing_unit_size(enc);
+    while ((nl = textreader_find_newline(enc, block, line_start, end)) != NULL)
+    {
+        size_t column = textreader_count_code_points(state, enc, line_start, nl);
+        if (line_start == block)
+            column += state->pos.column;
+
+        // the '\n' ends whatever sequence was still going
+        state->pending = 0;
+        textreader_position_push_line_end(state, column);
+        ++state->pos.line;
+        state->pos.column = 0;
+        line_start = nl + unit;
+    }
+    if (line_start == block)
+        state->pos.column += textreader_count_code_points(state, enc, line_start, end);
+    else
+        state->pos.column = textreader_count_code_points(state, enc, line_start, end);
+
+    state->pos.byte_offset += len;
+}
+
+// scans the data source from `from` to `to` without moving the reader
+static int textreader_position_scan(textreader_t *reader, struct textreader_position_state *state, off_t from, off_t to)
+{
+    if (to <= from)
+        return 0;
+
+    if (reader->flags & TRFLG_ISMEM)
+    {
+        if ((size_t)to > reader->data.mem.size)
+            to = reader->data.mem.size;
+
+        if (to > from)
+            textreader_position_advance(state, reader->encoding, (const uint8_t*)reader->data.mem.mem + from, to - from);
+
+        return 0;
+    }
+
+    uint8_t block[TEXTREADER_SCAN_BLOCK_SIZE];
+    int unit = textprocessing_unit_size(reader->encoding);
+    #ifndef TEXTREADER_HAVE_PREAD
+    // without pread it has to go through the FILE, which is only fine when there's nothing pushed back into it
+    off_t saved = ftello(reader->data.file);
+    if (saved < 0 || fseeko(reader->data.file, from, SEEK_SET) != 0)
+        return -1;
+
+    #endif
+    int rv = 0;
+    while (from < to)
+    {
+        size_t want = (size_t)(to - from) < sizeof(block) ? (size_t)(to - from) : sizeof(block);
+        #ifdef TEXTREADER_HAVE_PREAD
+        ssize_t got = pread(fileno(reader->data.file), block, want, from);
+        #else
+        long got = (long)fread(block, 1, want, reader->data.file);
+        #endif
+        // blocks end on a unit boundary, only the end of the range can have a cut off unit in it
+        if (got > 0 && from + got < to)
+            got -= got % unit;
+
+        if (got <= 0)
+        {
+            rv = -1;
+            break;
+        }
+        textreader_position_advance(state, reader->encoding, block, got);
+        from += got;
+    }
+    #ifndef TEXTREADER_HAVE_PREAD
+    if (fseeko(reader->data.file, saved, SEEK_SET) != 0)
+        rv = -1;
+
+    #endif
+    return rv;
+}
+
+// recomputes the whole position by scanning from the start of the text
+static int textreader_position_rescan(textreader_t *reader, off_t target)
+{
+    struct textreader_position_state *state = reader->position;
+    state->pos = (textreader_position_t){ 0, 0, reader->text_start_offset };
+    state->line_end_count = 0;
+    state->line_end_next = 0;
+    state->pending = 0;
+    if (target < reader->text_start_offset)
+    {
+        state->pos.byte_offset = target;
+        return 0;
+    }
+    return textreader_position_scan(reader, state, reader->text_start_offset, target);
+}
+
+static off_t textreader_source_offset(textreader_t *reader)
+{
+    if (reader->flags & TRFLG_ISMEM)
+        return (off_t)reader->data.mem.index;
+
+    if (reader->flags & TRFLG_PREFETCH)
+        return textreader_prefetch_tell(reader);
+
+    return ftello(reader->data.file);
+}
+
+static void textreader_position_after_seek(textreader_t *reader)
+{
+    struct textreader_position_state *state = reader->position;
+    off_t target = textreader_source_offset(reader);
+    if (target < 0)
+        return;
+
+    if (target >= state->pos.byte_offset)
+        textreader_position_scan(reader, state, state->pos.byte_offset, target);
+    else
+        textreader_position_rescan(reader, target);
+
+    state->pos.byte_offset = target;
+}
+
+int textreader_track_position(textreader_t *reader, int enable)
+{
+    if (!enable)
+    {
+        free(reader->position);
+        reader->position = NULL;
+        reader->flags &= ~TRFLG_TRACK_POSITION;
+        return 0;
+    }
+    if (reader->flags & TRFLG_TRACK_POSITION)
+        return 0;
+
+    off_t current = textreader_tello(reader);
+    if (current < 0)
+        return -1;
+
+    reader->position = malloc(sizeof(struct textreader_position_state));
+    if (reader->position == NULL)
+    {
+        errno = ENOMEM;
+        return -1;
+    }
+    if (textreader_position_rescan(reader, current) != 0)
+    {
+        free(reader->position);
+        reader->position = NULL;
+        return -1;
+    }
+    reader->flags |= TRFLG_TRACK_POSITION;
+    return 0;
+}
+
+textreader_position_t textreader_position(textreader_t *reader)
+{
+    if ((reader->flags & TRFLG_TRACK_POSITION) == 0)
+        return (textreader_position_t){ 0, 0, -1 };
+
+    return reader->position->pos;
+}
+
+// finds where the line that target is on starts, right after the '\n' before it or at the start of the text
+static off_t textreader_position_line_start(textreader_t *reader, off_t target)
+{
+    textprocessing_encoding_t enc = reader->encoding;
+    int unit = textprocessing_unit_size(enc);
+    size_t nl_index = textprocessing_is_big_endian(enc) ? unit - 1 : 0;
+    off_t start = reader->text_start_offset;
+    if ((reader->flags & TRFLG_ISMEM) && (size_t)target > reader->data.mem.size)
+        target = reader->data.mem.size;
+
+    off_t end = target - (target - start) % unit;
+    uint8_t buffer[TEXTREADER_SCAN_BLOCK_SIZE];
+    #ifndef TEXTREADER_HAVE_PREAD
+    off_t saved = -1;
+    #endif
+    while (end > start)
+    {
+        size_t want = (size_t)(end - start) < sizeof(buffer) ? (size_t)(end - start) : sizeof(buffer);
+        const uint8_t *block;
+        if (reader->flags & TRFLG_ISMEM)
+            block = (const uint8_t*)reader->data.mem.mem + (end - want);
+        else
+        {
+            #ifdef TEXTREADER_HAVE_PREAD
+            size_t got = 0;
+            while (got < want)
+            {
+                ssize_t n = pread(fileno(reader->data.file), buffer + got, want - got, end - want + got);
+                if (n <= 0)
+                    return -1;
+
+                got += n;
+            }
+            #else
+            if (saved < 0 && (saved = ftello(reader->data.file)) < 0)
+                return -1;
+
+            if (fseeko(reader->data.file, end - want, SEEK_SET) != 0 || fread(buffer, 1, want, reader->data.file) != want)
+            {
+                fseeko(reader->data.file, saved, SEEK_SET);
+                return -1;
+            }
+            #endif
+            block = buffer;
+        }
+        for (size_t i = want; i >= (size_t)unit; i -= unit)
+        {
+            const uint8_t *u = block + i - unit;
+            int is_newline = u[nl_index] == '\n';
+            for (int j = 0; j < unit && is_newline; ++j)
+                is_newline = (size_t)j == nl_index || u[j] == 0;
+
+            if (is_newline)
+            {
+                start = end - (off_t)want + (off_t)i;
+                break;
+            }
+        }
+        if (start != reader->text_start_offset)
+            break;
+
+        end -= want;
+    }
+    #ifndef TEXTREADER_HAVE_PREAD
+    if (saved >= 0 && fseeko(reader->data.file, saved, SEEK_SET) != 0)
+        return -1;
+
+    #endif
+    return start;
+}
+
+// after going back over a '\n' that wasn't remembered the column is counted from the start of the line,
+// that's only the line and not all the text before it
+static void textreader_position_find_column(textreader_t *reader)
+{
+    struct textreader_position_state *state = reader->position;
+    off_t target = state->pos.byte_offset;
+    off_t start = textreader_position_line_start(reader, target);
+    struct textreader_position_state line = { .pos = { 0, 0, start } };
+    if (start < 0 || textreader_position_scan(reader, &line, start, target) != 0)
+        line.pos.column = 0;
+
+    state->pos.column = line.pos.column;
+}
+
+// moves the position back over a character, returns 1 if the column has to be found with textreader_position_find_column
+static int textreader_position_back(struct textreader_position_state *state, int32_t chr, int byte_count)
+{
+    state->pos.byte_offset -= byte_count;
+    state->pending = 0;
+    if (chr != '\n')
+    {
+        if (state->pos.column > 0)
+            --state->pos.column;
+
+        return 0;
+    }
+    if (state->pos.line > 0)
+        --state->pos.line;
+
+    if (state->line_end_count > 0)
+    {
+        state->line_end_next = (state->line_end_next + TEXTREADER_POSITION_HISTORY - 1) % TEXTREADER_POSITION_HISTORY;
+        --state->line_end_count;
+        state->pos.column = state->line_end_columns[state->line_end_next];
+        return 0;
+    }
+    return 1;
+}
+
+static void textreader_position_consume(textreader_t *reader, int32_t chr, int byte_count)
+{
+    struct textreader_position_state *state = reader->position;
+    state->pos.byte_offset += byte_count;
+    state->pending = 0;
+    if (chr == '\n')
+    {
+        textreader_position_push_line_end(state, state->pos.column);
+        ++state->pos.line;
+        state->pos.column = 0;
+    }
+    else ++state->pos.column;
+}
+
+static void textreader_position_unconsume(textreader_t *reader, int32_t chr, int byte_count)
+{
+    if (textreader_position_back(reader->position, chr, byte_count))
+        textreader_position_find_column(reader);
+}
+
+int32_t textreader_getc(textreader_t *reader)
+{
+    int from_pushback = reader->total_ungetc_count != 0;
+    int byte_count = 0;
+    int32_t rslt = textreader_decode(reader, &byte_count);
+    if (rslt != EOF && (reader->flags & TRFLG_TRACK_POSITION))
+    {
+        // pushed back characters are stored as utf-8 so the byte count is for the original encoding
+        if (from_pushback)
+            byte_count = textreader_source_len(reader->encoding, rslt);
+
+        textreader_position_consume(reader, rslt, byte_count);
+    }
+    return rslt;
+}
+
+// widens bytes into code points, 16 at a time with sse2
+static void textreader_widen_bytes(const uint8_t *src, int32_t *out, size_t len)
+{
+    size_t i = 0;
+    #ifdef __SSE2__
+    __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= len; i += 16)
+    {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i low = _mm_unpacklo_epi8(bytes, zero);
+        __m128i high = _mm_unpackhi_epi8(bytes, zero);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128((__m128i*)(out + i + 4), _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128((__m128i*)(out + i + 8), _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128((__m128i*)(out + i + 12), _mm_unpackhi_epi16(high, zero));
+    }
+    #endif
+    for (; i < len; ++i)
+        out[i] = src[i];
+}
+
+// how many bytes from the start are ascii
+static size_t textreader_ascii_run(const uint8_t *src, size_t len)
+{
+    size_t i = 0;
+    #ifdef __SSE2__
+    for (; i + 16 <= len; i += 16)
+    {
+        int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(src + i)));
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+    #endif
+    for (; i < len && src[i] < 0x80; ++i);
+    return i;
+}
+
+/*
+ *  decodes as much as it can from memory, returns how many bytes were used and puts the number of decoded characters in decoded
+ *  it stops at anything that needs special handling (ill-formed or cut off sequences) and leaves it for getc
+ */
+static size_t textreader_decode_mem(textprocessing_encoding_t enc, const uint8_t *src, size_t avail, int32_t *out, size_t count, size_t *decoded)
+{
+    size_t used = 0, n = 0;
+    switch (enc)
+    {
+    case TPENC_ASCII:
+    case TPENC_UTF8:
+        while (n < count && used < avail)
+        {
+            size_t max = avail - used < count - n ? avail - used : count - n;
+            size_t run = textreader_ascii_run(src + used, max);
+            textreader_widen_bytes(src + used, out + n, run);
+            used += run;
+            n += run;
+            if (n >= count || used >= avail)
+                break;
+
+            if (enc != TPENC_UTF8)
+                break;
+
+            // the non ascii characters come in runs too, the common 2 and 3 byte ones are checked right here
+            while (n < count && used < avail && src[used] >= 0x80)
+            {
+                const uint8_t *p = src + used;
+                size_t left = avail - used;
+                if (p[0] >= 0xc2 && p[0] <= 0xdf && left >= 2 && (p[1] & 0xc0) == 0x80)
+                {
+                    out[n++] = ((p[0] & 0x1f) << 6) | (p[1] & 0x3f);
+                    used += 2;
+                    continue;
+                }
+                if (p[0] >= 0xe1 && p[0] <= 0xef && p[0] != 0xed && left >= 3 && (p[1] & 0xc0) == 0x80 && (p[2] & 0xc0) == 0x80)
+                {
+                    out[n++] = ((p[0] & 0x0f) << 12) | ((p[1] & 0x3f) << 6) | (p[2] & 0x3f);
+                    used += 3;
+                    continue;
+                }
+                int len = textprocessing_decode_chr(TPENC_UTF8, p, left, out + n);
+                if (len <= 0)
+                    goto utf8_end;
+
+                used += len;
+                ++n;
+            }
+        }
+utf8_end:
+        break;
+    case TPENC_LATIN1:
+        n = used = avail < count ? avail : count;
+        textreader_widen_bytes(src, out, n);
+        break;
+    case TPENC_CP1252:
+        n = used = avail < count ? avail : count;
+        textreader_widen_bytes(src, out, n);
+        // only the 0x80 - 0x9f bytes differ from latin-1
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (src[i] >= 0x80 && src[i] < 0xa0)
+                out[i] = textprocessing_cp1252_c1_table[src[i] - 0x80];
+        }
+        break;
+    case TPENC_UTF16:
+    case TPENC_UTF16LE:
+    case TPENC_UTF16BE:
+        {
+            int high = textprocessing_is_big_endian(enc) ? 0 : 1;
+            while (n < count && used + 2 <= avail)
+            {
+                uint16_t unit = (src[used + high] << 8) | src[used + 1-high];
+                if ((unit & 0xf800) != 0xd800)
+                {
+                    out[n++] = unit;
+                    used += 2;
+                    continue;
+                }
+                if (used + 4 > avail)
+                    break;
+
+                uint16_t low = (src[used + 2 + high] << 8) | src[used + 3-high];
+                if ((unit & 0xfc00) != 0xd800 || (low & 0xfc00) != 0xdc00)
+                    break;
+
+                out[n++] = ((((int32_t)unit & 0x3ff) << 10) | (low & 0x3ff)) + 0x10000;
+                used += 4;
+            }
+        }
+        break;
+    case TPENC_UTF32:
+    case TPENC_UTF32LE:
+    case TPENC_UTF32BE:
+        {
+            int is_be = textprocessing_is_big_endian(enc);
+            while (n < count && used + 4 <= avail)
+            {
+                uint32_t chr;
+                memcpy(&chr, src + used, 4);
+                if (is_be != textprocessing_is_big_endian(TPENC_UTF32))
+                    chr = (chr >> 24) | ((chr >> 8) & 0xff00) | ((chr << 8) & 0xff0000) | (chr << 24);
+
+                if (chr > 0x10ffff || (chr & 0xfffff800) == 0xd800)
+                    break;
+
+                out[n++] = chr;
+                used += 4;
+            }
+        }
+        break;
+    }
+    *decoded = n;
+    return used;
+}
+
+// decodes straight out of memory when the reader is reading from memory
+// everything else (files, pushback, ill-formed sequences) goes through getc
+size_t textreader_read(textreader_t *reader, int32_t *buffer, size_t count)
+{
+    size_t n = 0;
+    while (n < count)
+    {
+        if ((reader->flags & TRFLG_ISMEM) && reader->total_ungetc_count == 0 && reader->ungetc_stack.size == 0
+            && reader->data.mem.index < reader->data.mem.size)
+        {
+            const uint8_t *src = (const uint8_t*)reader->data.mem.mem + reader->data.mem.index;
+            size_t decoded;
+            size_t used = textreader_decode_mem(reader->encoding, src, reader->data.mem.size - reader->data.mem.index, buffer + n, count - n, &decoded);
+            if (used > 0)
+            {
+                reader->data.mem.index += used;
+                n += decoded;
+                if (reader->flags & TRFLG_TRACK_POSITION)
+                    textreader_position_advance(reader->position, reader->encoding, src, used);
+
+                continue;
+            }
+        }
+        #ifdef TEXTREADER_HAVE_PREAD
+        // prefetched blocks are decoded in place the same way
+        if ((reader->flags & TRFLG_PREFETCH) && reader->total_ungetc_count == 0 && reader->ungetc_stack.size == 0)
+        {
+            struct textreader_prefetch_state *state = reader->prefetch;
+            if (state->window.index < state->window.size)
+            {
+                const uint8_t *src = state->window.data + state->window.index;
+                size_t decoded;
+                size_t used = textreader_decode_mem(reader->encoding, src, state->window.size - state->window.index, buffer + n, count - n, &decoded);
+                if (used > 0)
+                {
+                    state->window.index += used;
+                    n += decoded;
+                    if (reader->flags & TRFLG_TRACK_POSITION)
+                        textreader_position_advance(reader->position, reader->encoding, src, used);
+
+                    continue;
+                }
+            }
+        }
+        #endif
+        int32_t chr = textreader_getc(reader);
+        if (chr == EOF)
+            break;
+
+        buffer[n++] = chr;
+    }
+    return n;
+}
+
+/*
+ *  backward decoding
+ *
+ *  the character before a position is found by looking at most 4 bytes back:
+ *      utf-8 goes back over up to 3 continuation bytes to the lead byte
+ *      utf-16 checks if the unit before a low surrogate is a high surrogate
+ *      utf-32 (and the odd byte at the end of utf-16) uses the distance from the start of the text
+ *
+ *  ill-formed sequences are split the same way the forward decoder splits them
+ *  (a truncated sequence is one replacement character, stray continuation bytes are one each)
+ *  so going backwards gives the same characters as going forwards, just reversed
+ */
+
+// how many bytes at the start of p (up to len) are a valid prefix of a utf-8 sequence
+// needed gets the length of the whole sequence, or 0 if p[0] can't start one
+static int textreader_utf8_prefix(const uint8_t *p, int len, int *needed)
+{
+    uint8_t c = p[0];
+    uint8_t lower = 0x80, upper = 0xbf;
+    if (c < 0x80)
+        *needed = 1;
+    else if (c >= 0xc2 && c <= 0xdf)
+        *needed = 2;
+    else if (c >= 0xe0 && c <= 0xef)
+    {
+        *needed = 3;
+        if (c == 0xe0)
+            lower = 0xa0;
+        else if (c == 0xed)
+            upper = 0x9f;
+    }
+    else if (c >= 0xf0 && c <= 0xf4)
+    {
+        *needed = 4;
+        if (c == 0xf0)
+            lower = 0x90;
+        else if (c == 0xf4)
+            upper = 0x8f;
+    }
+    else
+    {
+        *needed = 0;
+        return 0;
+    }
+    int got = 1;
+    while (got < len && got < *needed && p[got] >= lower && p[got] <= upper)
+    {
+        ++got;
+        lower = 0x80;
+        upper = 0xbf;
+    }
+    return got;
+}
+
+static uint16_t textreader_load_unit16(textprocessing_encoding_t enc, const uint8_t *p)
+{
+    if (enc == TPENC_UTF16)
+    {
+        uint16_t unit;
+        memcpy(&unit, p, 2);
+        return unit;
+    }
+    return enc == TPENC_UTF16BE ? (p[0] << 8) | p[1] : p[0] | (p[1] << 8);
+}
+
+/*
+ *  decodes the character that ends right before p, nothing before start is looked at
+ *  start has to be the start of the text or a multiple of 4 bytes after it (for the utf-16/32 alignment)
+ *
+ *  returns how many bytes the character takes, or minus that for an ill-formed sequence
+ */
+static int textreader_decode_prev(textprocessing_encoding_t enc, const uint8_t *start, const uint8_t *p, int32_t *chr)
+{
+    size_t avail = p - start;
+    switch (enc)
+    {
+    case TPENC_ASCII:
+        *chr = p[-1];
+        return p[-1] < 0x80 ? 1 : -1;
+    case TPENC_LATIN1:
+        *chr = p[-1];
+        return 1;
+    case TPENC_CP1252:
+        *chr = p[-1];
+        if (*chr >= 0x80 && *chr < 0xa0)
+            *chr = textprocessing_cp1252_c1_table[*chr - 0x80];
+
+        return 1;
+    case TPENC_UTF32BE:
+    case TPENC_UTF32LE:
+    case TPENC_UTF32:
+        if (avail % 4 != 0)
+            return -(int)(avail % 4);
+
+        return textprocessing_decode_chr(enc, p - 4, 4, chr) == 4 ? 4 : -4;
+    case TPENC_UTF16BE:
+    case TPENC_UTF16LE:
+    case TPENC_UTF16:
+    {
+        if (avail % 2 != 0)
+            return -1;
+
+        uint16_t unit = textreader_load_unit16(enc, p - 2);
+        *chr = unit;
+        if ((unit & 0xf800) != 0xd800)
+            return 2;
+
+        if ((unit & 0xfc00) == 0xd800 || avail < 4)
+            return -2;
+
+        uint16_t high = textreader_load_unit16(enc, p - 4);
+        if ((high & 0xfc00) != 0xd800)
+            return -2;
+
+        *chr = ((((int32_t)high & 0x3ff) << 10) | (unit & 0x3ff)) + 0x10000;
+        return 4;
+    }
+    case TPENC_UTF8:
+    {
+        const uint8_t *lead = p - 1;
+        while (lead > start && p - lead < 4 && (*lead & 0xc0) == 0x80)
+            --lead;
+
+        int len = p - lead;
+        int needed;
+        int got = textreader_utf8_prefix(lead, len, &needed);
+        if (got == len && got == needed)
+        {
+            textprocessing_decode_chr(TPENC_UTF8, lead, len, chr);
+            return len;
+        }
+        // the lead byte and everything after it is one cut off sequence,
+        // otherwise the last byte is a continuation byte that doesn't belong to anything
+        return got == len && needed != 0 ? -len : -1;
+    }
+    default:
+        return 0;
+    }
+}
+
+// makes the reverse block hold the (up to) 4 bytes before pos, reading a new block that ends at pos if it has to
+static int textreader_reverse_load(textreader_t *reader, off_t pos)
+{
+    struct textreader_reverse_state *state = reader->reverse;
+    if (state == NULL)
+    {
+        state = malloc(sizeof(struct textreader_reverse_state));
+        if (state == NULL)
+        {
+            errno = ENOMEM;
+            reader->flags |= TRFLG_ERROR;
+            return -1;
+        }
+        state->block_len = 0;
+        reader->reverse = state;
+    }
+    off_t block_end = state->block_start + (off_t)state->block_len;
+    if (state->block_len != 0 && pos > state->block_start && pos <= block_end
+        && (pos - state->block_start >= 4 || state->block_start == reader->text_start_offset))
+        return 0;
+
+    // blocks start a multiple of 4 bytes after the start of the text so utf-16/32 stay aligned
+    off_t start = reader->text_start_offset;
+    if (pos - start > TEXTREADER_REVERSE_BLOCK_SIZE)
+        start += (pos - start - TEXTREADER_REVERSE_BLOCK_SIZE + 3) & ~(off_t)3;
+
+    size_t want = pos - start;
+    state->block_len = 0;
+    #ifdef TEXTREADER_HAVE_PREAD
+    while (state->block_len < want)
+    {
+        ssize_t got = pread(fileno(reader->data.file), state->block + state->block_len, want - state->block_len, start + state->block_len);
+        if (got <= 0)
+        {
+            state->block_len = 0;
+            reader->flags |= TRFLG_ERROR;
+            return -1;
+        }
+        state->block_len += got;
+    }
+    #else
+    if (fseeko(reader->data.file, start, SEEK_SET) != 0 || fread(state->block, 1, want, reader->data.file) != want)
+    {
+        reader->flags |= TRFLG_ERROR;
+        return -1;
+    }
+    state->block_len = want;
+    #endif
+    state->block_start = start;
+    return 0;
+}
+
+// the source offset of the next character, with the pushed back characters counted as being where they were read from
+static off_t textreader_prev_origin(textreader_t *reader)
+{
+    if (reader->total_ungetc_count != 0)
+    {
+        struct textreader_position_state saved;
+        if (reader->flags & TRFLG_TRACK_POSITION)
+            saved = *reader->position;
+
+        off_t back = 0;
+        while (reader->total_ungetc_count != 0)
+        {
+            int32_t chr = textreader_getc(reader);
+            if (chr == EOF)
+                return -1;
+
+            back += textreader_source_len(reader->encoding, chr);
+        }
+        off_t pos = textreader_source_offset(reader);
+        if (reader->flags & TRFLG_TRACK_POSITION)
+            *reader->position = saved;
+
+        return pos < 0 ? -1 : pos - (off_t)reader->ungetc_stack.size - back;
+    }
+    off_t pos = textreader_source_offset(reader);
+    return pos < 0 ? -1 : pos - (off_t)reader->ungetc_stack.size;
+}
+
+size_t textreader_read_prev(textreader_t *reader, int32_t *buffer, size_t count)
+{
+    off_t pos = textreader_prev_origin(reader);
+    if (pos < 0)
+    {
+        reader->flags |= TRFLG_ERROR;
+        return 0;
+    }
+    textprocessing_encoding_t enc = reader->encoding;
+    int is_mem = reader->flags & TRFLG_ISMEM;
+    if (is_mem && (size_t)pos > reader->data.mem.size)
+        pos = reader->data.mem.size;
+
+    // ascii bytes are the same character going either way, so runs of them are copied without decoding
+    int byte_encoding = enc == TPENC_UTF8 || enc == TPENC_ASCII || enc == TPENC_LATIN1 || enc == TPENC_CP1252;
+    int tracking = reader->flags & TRFLG_TRACK_POSITION;
+    // the column is found once at the end if it went back over a line end that wasn't remembered
+    int find_column = 0;
+    int failed = 0;
+    size_t n = 0;
+    while (n < count && pos > reader->text_start_offset && !failed)
+    {
+        const uint8_t *start, *p;
+        int at_text_start;
+        if (is_mem)
+        {
+            start = (const uint8_t*)reader->data.mem.mem + reader->text_start_offset;
+            p = (const uint8_t*)reader->data.mem.mem + pos;
+            at_text_start = 1;
+        }
+        else
+        {
+            if (textreader_reverse_load(reader, pos) != 0)
+            {
+                failed = 1;
+                break;
+            }
+            start = reader->reverse->block;
+            p = start + (pos - reader->reverse->block_start);
+            at_text_start = reader->reverse->block_start == reader->text_start_offset;
+        }
+        const uint8_t *block_end = p;
+
+        // the decoder looks up to 4 bytes back, so near the start of a block the next one has to be read first
+        while (n < count && p > start && (at_text_start || p - start >= 4))
+        {
+            if (byte_encoding && !tracking)
+            {
+                while (n < count && p > start && p[-1] < 0x80)
+                    buffer[n++] = *--p;
+
+                if (n == count || p == start || (!at_text_start && p - start < 4))
+                    break;
+            }
+            int32_t chr;
+            int got = textreader_decode_prev(enc, start, p, &chr);
+            if (got == 0)
+            {
+                errno = EINVAL;
+                reader->flags |= TRFLG_ERROR;
+                failed = 1;
+                break;
+            }
+            if (got < 0)
+            {
+                if ((reader->flags & TRFLG_REPLACE_INVALID) == 0)
+                {
+                    errno = EILSEQ;
+                    reader->flags |= TRFLG_ERROR;
+                    failed = 1;
+                    break;
+                }
+                got = -got;
+                chr = TEXTREADER_REPLACEMENT_CHARACTER;
+                if (reader->error_count++ == 0)
+                    reader->first_error_offset = pos - (block_end - p) - got;
+            }
+            p -= got;
+            if (tracking && textreader_position_back(reader->position, chr, got))
+                find_column = 1;
+
+            buffer[n++] = chr;
+        }
+        pos -= block_end - p;
+    }
+
+    if (find_column)
+        textreader_position_find_column(reader);
+
+    // the reader continues forwards from where it stopped
+    reader->ungetc_stack.size = 0;
+    reader->total_ungetc_count = 0;
+    if (is_mem)
+    {
+        reader->data.mem.index = pos;
+        reader->flags &= ~TRFLG_EOF;
+    }
+    else if (textreader_seeko(reader, pos, SEEK_SET) != 0)
+        reader->flags |= TRFLG_ERROR;
+
+    return n;
+}
+
+int32_t textreader_getc_prev(textreader_t *reader)
+{
+    int32_t chr;
+    return textreader_read_prev(reader, &chr, 1) == 1 ? chr : EOF;
+}
+
+static void *textreader_read_into_arena(textreader_t *reader, textprocessing_encoding_t out_encoding, textprocessing_arena_t *arena, size_t *out_len, int stop_at_newline)
+{
+    size_t capacity = 256;
+    size_t size = 0;
+    uint8_t *out = textprocessing_arena_alloc(arena, capacity);
+    if (out == NULL)
+        return NULL;
+
+    int32_t chr;
+    while ((chr = textreader_getc(reader)) != EOF)
+    {
+        // enough space for the longest encoded character + the terminator
+        if (capacity - size < 8)
+        {
+            uint8_t *new_out = textprocessing_arena_grow(arena, out, capacity, capacity * 2);
+            if (new_out == NULL)
+                return NULL;
+
+            out = new_out;
+            capacity *= 2;
+        }
+        int len = textprocessing_encode_chr(out_encoding, chr, out + size);
+        if (len < 0)
+            return NULL;
+
+        size += len;
+        if (stop_at_newline && chr == '\n')
+            break;
+    }
+    if (chr == EOF && ((reader->flags & TRFLG_ERROR) || !textreader_eof(reader) || (size == 0 && stop_at_newline)))
+    {
+        // give back the memory since it's most likely the last allocation
+        textprocessing_arena_grow(arena, out, capacity, 0);
+        return NULL;
+    }
+    int terminator_len = textprocessing_encode_chr(out_encoding, 0, out + size);
+    out = textprocessing_arena_grow(arena, out, capacity, size + terminator_len);
+    if (out_len != NULL)
+        *out_len = size;
+
+    return out;
+}
+
+void *textreader_getline(textreader_t *reader, textprocessing_encoding_t out_encoding, textprocessing_arena_t *arena, size_t *out_len)
+{
+    return textreader_read_into_arena(reader, out_encoding, arena, out_len, 1);
+}
+
+void *textreader_read_all(textreader_t *reader, textprocessing_encoding_t out_encoding, textprocessing_arena_t *arena, size_t *out_len)
+{
+    return textreader_read_into_arena(reader, out_encoding, arena, out_len, 0);
+}
+
+void textreader_clearerr(textreader_t *reader)
+{
+    reader->error_count = 0;
+    if ((reader->flags & TRFLG_ISMEM) == 0)
+        clearerr(reader->data.file);
+
+    reader->flags &= ~TRFLG_ERROR;
+}
+
+int textreader_close(textreader_t *reader, int close_file)
+{
+    textreader_free_pushback(reader);
+    textreader_track_position(reader, 0);
+    textreader_follow(reader, 0, NULL);
+    textreader_prefetch(reader, 0);
+    free(reader->reverse);
+    reader->reverse = NULL;
+    free(reader->scratch);
+    reader->scratch = NULL;
+    reader->scratch_capacity = 0;
+    if ((reader->flags & TRFLG_ISMEM) == 0 && (close_file || !(reader->flags & TRFLG_IS_INIT_FILEPTR)))
+        return fclose(reader->data.file);
+
+    return 0;
+}
+
+int textreader_pool_init(textreader_pool_t *pool, size_t capacity)
+{
+    *pool = (textreader_pool_t){
+        .readers = calloc(capacity, sizeof(textreader_t)),
+        .capacity = capacity,
+        .free_slots = malloc(capacity * sizeof(size_t)),
+        .free_slot_count = capacity
+    };
+    if (pool->readers == NULL || pool->free_slots == NULL)
+    {
+        textreader_pool_destroy(pool);
+        errno = ENOMEM;
+        return -1;
+    }
+    // hand out the slots from the start of the array first
+    for (size_t i = 0; i < capacity; ++i)
+        pool->free_slots[i] = capacity - i - 1;
+
+    return 0;
+}
+
+void textreader_pool_destroy(textreader_pool_t *pool)
+{
+    while (pool->pushback_slabs != NULL)
+    {
+        void *next = *(void**)pool->pushback_slabs;
+        free(pool->pushback_slabs);
+        pool->pushback_slabs = next;
+    }
+    free(pool->readers);
+    free(pool->free_slots);
+    *pool = (textreader_pool_t){ 0 };
+}
+
+textreader_t *textreader_pool_acquire(textreader_pool_t *pool, textreader_t reader)
+{
+    if (pool->free_slot_count == 0)
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+    // a pushback buffer that was malloc'd before the reader joined the pool is swapped for one of the pool's,
+    // otherwise it would end up in the pool's free list when the reader gives it back
+    if (reader.ungetc_stack.buffer != NULL && reader.pool == NULL)
+    {
+        char *buffer = textreader_pool_get_pushback(pool);
+        if (buffer == NULL)
+        {
+            errno = ENOMEM;
+            return NULL;
+        }
+        memcpy(buffer, reader.ungetc_stack.buffer, reader.ungetc_stack.size);
+        free(reader.ungetc_stack.buffer);
+        reader.ungetc_stack.buffer = buffer;
+    }
+    textreader_t *slot = &pool->readers[pool->free_slots[--pool->free_slot_count]];
+    *slot = reader;
+    slot->pool = pool;
+    return slot;
+}
+
+int textreader_pool_release(textreader_pool_t *pool, textreader_t *reader, int close_file)
+{
+    int rv = textreader_close(reader, close_file);
+    pool->free_slots[pool->free_slot_count++] = (size_t)(reader - pool->readers);
+    reader->pool = NULL;
+    return rv;
 }
@@ -0,0 +1,355 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#include <textprocessing/textreader.h>
+
+#if defined(__linux__)
+    #include <unistd.h>
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #define TEXTREADER_FOLLOW_INOTIFY
+#elif defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <unistd.h>
+#endif
+
+// even with inotify the file is checked this often, events can get lost on network file systems
+#ifndef TEXTREADER_FOLLOW_RECHECK_INTERVAL
+#define TEXTREADER_FOLLOW_RECHECK_INTERVAL 1000
+#endif
+
+struct textreader_follow_state
+{
+    char *path; // NULL if rotation isn't checked
+    // the file was truncated or replaced and its BOM (if it has one) hasn't been read yet
+    int bom_pending;
+    #ifdef TEXTREADER_FOLLOW_INOTIFY
+    int inotify_fd; // -1 if inotify couldn't be used
+    int file_watch;
+    int dir_watch;
+    #endif
+};
+
+#ifdef TEXTREADER_FOLLOW_INOTIFY
+static void textreader_follow_watch_file(textreader_t *reader)
+{
+    struct textreader_follow_state *state = reader->follow;
+    if (state->inotify_fd < 0)
+        return;
+
+    if (state->file_watch >= 0)
+        inotify_rm_watch(state->inotify_fd, state->file_watch);
+
+    // without a path the file is watched through its descriptor, the /proc link is followed to the file itself
+    char fd_path[64];
+    const char *watched = state->path;
+    if (watched == NULL)
+    {
+        snprintf(fd_path, sizeof(fd_path), "/proc/self/fd/%d", fileno(reader->data.file));
+        watched = fd_path;
+    }
+    state->file_watch = inotify_add_watch(state->inotify_fd, watched, IN_MODIFY | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF);
+}
+
+static void textreader_follow_init_inotify(textreader_t *reader)
+{
+    struct textreader_follow_state *state = reader->follow;
+    state->file_watch = -1;
+    state->dir_watch = -1;
+    state->inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (state->inotify_fd < 0)
+        return;
+
+    textreader_follow_watch_file(reader);
+    if (state->file_watch < 0)
+    {
+        close(state->inotify_fd);
+        state->inotify_fd = -1;
+        return;
+    }
+    // the directory is watched for the new file that a rotation creates
+    if (state->path != NULL)
+    {
+        const char *slash = strrchr(state->path, '/');
+        char *dir = slash == NULL ? strdup(".") : strndup(state->path, slash == state->path ? 1 : (size_t)(slash - state->path));
+        if (dir != NULL)
+        {
+            state->dir_watch = inotify_add_watch(state->inotify_fd, dir, IN_CREATE | IN_MOVED_TO);
+            free(dir);
+        }
+    }
+}
+#endif
+
+int textreader_follow(textreader_t *reader, int enable, const char *path)
+{
+    struct textreader_follow_state *state = reader->follow;
+    if (!enable)
+    {
+        if (state != NULL)
+        {
+            #ifdef TEXTREADER_FOLLOW_INOTIFY
+            if (state->inotify_fd >= 0)
+                close(state->inotify_fd);
+            #endif
+            free(state->path);
+            free(state);
+        }
+        reader->follow = NULL;
+        reader->flags &= ~TRFLG_FOLLOW;
+        return 0;
+    }
+    // prefetching reads the file in blocks so it wouldn't see the file grow
+    if (reader->flags & (TRFLG_ISMEM | TRFLG_PREFETCH))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    if (state != NULL)
+        textreader_follow(reader, 0, NULL);
+
+    state = calloc(1, sizeof(struct textreader_follow_state));
+    if (state == NULL || (path != NULL && (state->path = strdup(path)) == NULL))
+    {
+        free(state);
+        errno = ENOMEM;
+        return -1;
+    }
+    reader->follow = state;
+    #ifdef TEXTREADER_FOLLOW_INOTIFY
+    textreader_follow_init_inotify(reader);
+    #endif
+    reader->flags |= TRFLG_FOLLOW;
+    return 0;
+}
+
+// starts reading the (truncated or new) file from the beginning, the BOM is checked once there's something in it
+static int textreader_follow_restart(textreader_t *reader)
+{
+    // seeking would throw away the start of a character that the old file ended in without a trace
+    if (textreader_drop_cut_off(reader) != 0)
+        return -1;
+
+    reader->text_start_offset = 0;
+    if (textreader_seeko(reader, 0, SEEK_SET) != 0)
+        return -1;
+
+    reader->follow->bom_pending = 1;
+    return 0;
+}
+
+// switches to the file that's at the path now
+static int textreader_follow_reopen(textreader_t *reader)
+{
+    FILE *file = fopen(reader->follow->path, "rb");
+    // it could've been moved away again, it'll be checked on the next wake up
+    if (file == NULL)
+        return 0;
+
+    // the offset of the cut off character is in the old file
+    if (textreader_drop_cut_off(reader) != 0)
+    {
+        fclose(file);
+        return -1;
+    }
+    if ((reader->flags & TRFLG_IS_INIT_FILEPTR) == 0)
+        fclose(reader->data.file);
+
+    reader->data.file = file;
+    reader->flags &= ~TRFLG_IS_INIT_FILEPTR;
+    #ifdef TEXTREADER_FOLLOW_INOTIFY
+    textreader_follow_watch_file(reader);
+    #endif
+    return textreader_follow_restart(reader) == 0 ? 1 : -1;
+}
+
+// whether the size bytes at the start of the file could still become a BOM once more is written
+static int textreader_follow_partial_bom(textreader_t *reader, off_t size)
+{
+    // the utf-16le BOM is the start of the utf-32le one
+    static const char *const boms[] = { "\xef\xbb\xbf", "\xff\xfe\x00\x00", "\x00\x00\xfe\xff" };
+    static const size_t bom_lens[] = { 3, 4, 4 };
+    uint8_t start[4];
+    if (size >= 4)
+        return 0;
+
+    if (fseeko(reader->data.file, 0, SEEK_SET) != 0 || fread(start, 1, (size_t)size, reader->data.file) != (size_t)size
+        || fseeko(reader->data.file, 0, SEEK_SET) != 0)
+        return -1;
+
+    for (size_t i = 0; i < sizeof(boms) / sizeof(boms[0]); ++i)
+    {
+        if ((size_t)size < bom_lens[i] && memcmp(start, boms[i], (size_t)size) == 0)
+            return 1;
+    }
+    return 0;
+}
+
+// returns 1 if there's something to read, 0 if not or -1 on error
+static int textreader_follow_check(textreader_t *reader)
+{
+    struct textreader_follow_state *state = reader->follow;
+    for (;;)
+    {
+        struct stat st;
+        off_t offset = ftello(reader->data.file);
+        if (offset < 0 || fstat(fileno(reader->data.file), &st) != 0)
+        {
+            reader->flags |= TRFLG_ERROR;
+            return -1;
+        }
+        // the first bytes of a BOM aren't text yet, it's checked once the whole BOM could be there
+        int partial_bom = 0;
+        if (st.st_size > offset)
+            clearerr(reader->data.file);
+
+        if (st.st_size > offset && state->bom_pending)
+        {
+            partial_bom = textreader_follow_partial_bom(reader, st.st_size);
+            if (partial_bom < 0)
+            {
+                reader->flags |= TRFLG_ERROR;
+                return -1;
+            }
+            if (!partial_bom)
+            {
+                state->bom_pending = 0;
+                if (textreader_detect_bom(reader) != 0)
+                    return -1;
+            }
+        }
+        if (st.st_size > offset && !partial_bom)
+        {
+            reader->flags &= ~TRFLG_EOF;
+            return 1;
+        }
+        if (st.st_size < offset)
+        {
+            if (textreader_follow_restart(reader) != 0)
+                return -1;
+
+            continue;
+        }
+        // everything in the current file has been read, so it's safe to move on to a new one
+        struct stat path_st;
+        if (state->path == NULL || stat(state->path, &path_st) != 0
+            || (path_st.st_ino == st.st_ino && path_st.st_dev == st.st_dev))
+            return 0;
+
+        int reopened = textreader_follow_reopen(reader);
+        if (reopened <= 0)
+            return reopened;
+    }
+}
+
+static long long textreader_follow_now_ms(void)
+{
+    #ifdef _WIN32
+    return (long long)GetTickCount64();
+    #else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+    #endif
+}
+
+static void textreader_follow_sleep(int ms)
+{
+    #ifdef _WIN32
+    Sleep(ms);
+    #else
+    struct timespec ts = { ms / 1000, (long)(ms % 1000) * 1000000 };
+    nanosleep(&ts, NULL);
+    #endif
+}
+
+// blocks for at most ms milliseconds or until the file (or its directory) changes
+static int textreader_follow_block(textreader_t *reader, int ms)
+{
+    #ifdef TEXTREADER_FOLLOW_INOTIFY
+    struct textreader_follow_state *state = reader->follow;
+    if (state->inotify_fd >= 0)
+    {
+        if (ms > TEXTREADER_FOLLOW_RECHECK_INTERVAL)
+            ms = TEXTREADER_FOLLOW_RECHECK_INTERVAL;
+
+        struct pollfd pfd = { .fd = state->inotify_fd, .events = POLLIN };
+        int rv = poll(&pfd, 1, ms);
+        if (rv < 0 && errno != EINTR)
+            return -1;
+
+        // the events only wake it up, what changed is found out with fstat/stat
+        char events[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+        while (read(state->inotify_fd, events, sizeof(events)) > 0)
+            ;
+
+        return 0;
+    }
+    #endif
+    (void)reader;
+    textreader_follow_sleep(ms < TEXTREADER_FOLLOW_POLL_INTERVAL ? ms : TEXTREADER_FOLLOW_POLL_INTERVAL);
+    return 0;
+}
+
+int textreader_follow_wait(textreader_t *reader, int timeout_ms)
+{
+    if ((reader->flags & TRFLG_FOLLOW) == 0)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    long long deadline = textreader_follow_now_ms() + timeout_ms;
+    for (;;)
+    {
+        int rv = textreader_follow_check(reader);
+        if (rv != 0)
+            return rv;
+
+        int ms = TEXTREADER_FOLLOW_RECHECK_INTERVAL;
+        if (timeout_ms >= 0)
+        {
+            long long left = deadline - textreader_follow_now_ms();
+            if (left <= 0)
+                return 0;
+
+            if (left < ms)
+                ms = (int)left;
+        }
+        if (textreader_follow_block(reader, ms) != 0)
+        {
+            reader->flags |= TRFLG_ERROR;
+            return -1;
+        }
+    }
+}
+
+size_t textreader_read_follow(textreader_t *reader, int32_t *buffer, size_t count, int timeout_ms)
+{
+    long long deadline = textreader_follow_now_ms() + timeout_ms;
+    for (;;)
+    {
+        // nothing in a new file is read before its BOM has been checked
+        int ready = (reader->flags & TRFLG_FOLLOW) && reader->follow->bom_pending ? textreader_follow_check(reader) : 1;
+        if (ready < 0)
+            return 0;
+
+        size_t n = ready ? textreader_read(reader, buffer, count) : 0;
+        if (n > 0 || textreader_error(reader))
+            return n;
+
+        // what was written could've been the start of a character, then it waits again for what's left of the timeout
+        int ms = timeout_ms;
+        if (timeout_ms >= 0)
+        {
+            long long left = deadline - textreader_follow_now_ms();
+            ms = left > 0 ? (int)left : 0;
+        }
+        if (textreader_follow_wait(reader, ms) <= 0)
+            return 0;
+    }
+}
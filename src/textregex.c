@@ -0,0 +1,1273 @@
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+
+#include <textprocessing/textregex.h>
+#include <textprocessing/arena.h>
+
+#define TEXTREGEX_MAX_CODE_POINT 0x10ffff
+#define TEXTREGEX_MAX_REPEAT 1000
+#define TEXTREGEX_MAX_NFA_STATES 200000
+#define TEXTREGEX_MAX_PREFIX 32
+
+#define DFA_UNKNOWN -1
+#define DFA_DEAD    -2
+
+/*
+ *  how it works:
+ *      1. the pattern is parsed into a tree where every character/class is a list of code point ranges
+ *      2. the tree is compiled into an NFA over bytes, the code point ranges become alternations of utf-8 byte range sequences
+ *      3. DFA states (sets of NFA states) are only made when the scan gets to them and kept in a cache of limited size
+ */
+
+typedef struct regex_range
+{
+    int32_t lo, hi;
+} regex_range_t;
+
+typedef enum regex_node_type
+{
+    NODE_EMPTY,
+    NODE_CLASS,
+    NODE_CONCAT,
+    NODE_ALT,
+    NODE_STAR,
+    NODE_PLUS,
+    NODE_QUEST,
+    NODE_ASSERT_START,
+    NODE_ASSERT_END
+} regex_node_type_t;
+
+typedef struct regex_node
+{
+    regex_node_type_t type;
+    struct regex_node *left, *right;
+    regex_range_t *ranges;
+    size_t range_count;
+} regex_node_t;
+
+typedef enum nfa_type
+{
+    NFA_RANGE,
+    NFA_SPLIT,
+    NFA_MATCH,
+    // ^ and $, they're only passed through at the start/end of the text
+    NFA_ASSERT_START,
+    NFA_ASSERT_END
+} nfa_type_t;
+
+typedef struct nfa_state
+{
+    uint8_t type;
+    uint8_t lo, hi;
+    int out, out1;
+} nfa_state_t;
+
+// the flags of a DFA state, they're a part of its key in the cache like the NFA states are
+#define DFA_ANCHORED    1   // never starts a new match after a byte (textregex_match)
+#define DFA_AT_START    2   // the state at the start of the text, where ^ is passed through
+
+// the flags nfa_closure follows the asserts with
+#define CLOSURE_AT_START    1
+#define CLOSURE_AT_END      2
+
+typedef struct dfa_state
+{
+    int32_t next[256];
+    int is_match;
+    // matches if the text ends here, the $ in the state are passed through for this
+    int match_at_end;
+    int flags;
+    int nfa_count;
+    int *nfa;
+    uint32_t hash;
+} dfa_state_t;
+
+struct textregex
+{
+    nfa_state_t *nfa;
+    int nfa_count;
+    int nfa_capacity;
+    int nfa_start;
+
+    uint8_t prefix[TEXTREGEX_MAX_PREFIX];
+    size_t prefix_len;
+
+    dfa_state_t *states;
+    int state_count;
+    int max_states;
+    int *hash_table;
+    int hash_capacity;
+    int start_state[2]; // unanchored and anchored
+    int restart_state; // where a search is when nothing is partially matched, for the prefilter
+    size_t flush_count;
+
+    // scratch space for building the NFA state sets
+    int *set;
+    int *stack;
+    uint32_t *marks;
+    uint32_t mark_generation;
+};
+
+typedef struct regex_parser
+{
+    textreader_t reader;
+    int32_t chr;
+    textprocessing_arena_t *arena;
+    int depth;
+    int error;
+} regex_parser_t;
+
+static void parser_next(regex_parser_t *p)
+{
+    p->chr = textreader_getc(&p->reader);
+    if (p->chr == EOF && textreader_error(&p->reader))
+        p->error = 1;
+}
+
+static regex_node_t *new_node(regex_parser_t *p, regex_node_type_t type, regex_node_t *left, regex_node_t *right)
+{
+    regex_node_t *node = textprocessing_arena_alloc(p->arena, sizeof(regex_node_t));
+    if (node == NULL)
+    {
+        p->error = 1;
+        return NULL;
+    }
+    *node = (regex_node_t){ .type = type, .left = left, .right = right };
+    return node;
+}
+
+static int class_add(regex_parser_t *p, regex_node_t *node, int32_t lo, int32_t hi)
+{
+    regex_range_t *ranges = textprocessing_arena_grow(p->arena, node->ranges,
+        node->range_count * sizeof(regex_range_t), (node->range_count + 1) * sizeof(regex_range_t));
+    if (ranges == NULL)
+    {
+        p->error = 1;
+        return -1;
+    }
+    node->ranges = ranges;
+    node->ranges[node->range_count++] = (regex_range_t){ lo, hi };
+    return 0;
+}
+
+static int compare_ranges(const void *a, const void *b)
+{
+    const regex_range_t *ra = a, *rb = b;
+    return (ra->lo > rb->lo) - (ra->lo < rb->lo);
+}
+
+// sorts and merges the ranges, and flips them if negate is set
+static void class_normalize(regex_parser_t *p, regex_node_t *node, int negate)
+{
+    qsort(node->ranges, node->range_count, sizeof(regex_range_t), compare_ranges);
+    size_t count = 0;
+    for (size_t i = 0; i < node->range_count; ++i)
+    {
+        if (count > 0 && node->ranges[i].lo <= node->ranges[count-1].hi + 1)
+        {
+            if (node->ranges[i].hi > node->ranges[count-1].hi)
+                node->ranges[count-1].hi = node->ranges[i].hi;
+        }
+        else node->ranges[count++] = node->ranges[i];
+    }
+    node->range_count = count;
+    if (!negate)
+        return;
+
+    // the gaps between the ranges, there's at most one more of them than there are ranges
+    regex_range_t *negated = textprocessing_arena_alloc(p->arena, (count + 1) * sizeof(regex_range_t));
+    if (negated == NULL)
+    {
+        p->error = 1;
+        return;
+    }
+    size_t negated_count = 0;
+    int32_t prev_hi = -1;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (node->ranges[i].lo > prev_hi + 1)
+            negated[negated_count++] = (regex_range_t){ prev_hi + 1, node->ranges[i].lo - 1 };
+
+        prev_hi = node->ranges[i].hi;
+    }
+    if (prev_hi < TEXTREGEX_MAX_CODE_POINT)
+        negated[negated_count++] = (regex_range_t){ prev_hi + 1, TEXTREGEX_MAX_CODE_POINT };
+
+    node->ranges = negated;
+    node->range_count = negated_count;
+}
+
+static int parse_hex(regex_parser_t *p, int max_digits, int32_t *value)
+{
+    int digits = 0;
+    *value = 0;
+    while (digits < max_digits)
+    {
+        int32_t c = p->chr;
+        int d;
+        if (c >= '0' && c <= '9')
+            d = c - '0';
+        else if (c >= 'a' && c <= 'f')
+            d = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F')
+            d = c - 'A' + 10;
+        else
+            break;
+
+        *value = *value * 16 + d;
+        ++digits;
+        parser_next(p);
+    }
+    return digits;
+}
+
+static int escape_class(regex_parser_t *p, regex_node_t *node, int32_t c)
+{
+    switch (c)
+    {
+    case 'd':
+        return class_add(p, node, '0', '9');
+    case 'w':
+        class_add(p, node, '0', '9');
+        class_add(p, node, 'A', 'Z');
+        class_add(p, node, 'a', 'z');
+        return class_add(p, node, '_', '_');
+    case 's':
+        class_add(p, node, '\t', '\r');
+        return class_add(p, node, ' ', ' ');
+    }
+    return -1;
+}
+
+// adds the ranges of an escape to the class, p->chr is the character after the backslash
+static int parse_escape(regex_parser_t *p, regex_node_t *node)
+{
+    int32_t c = p->chr;
+    parser_next(p);
+    switch (c)
+    {
+    case EOF:
+        p->error = 1;
+        return -1;
+    case 'd':
+    case 'w':
+    case 's':
+        return escape_class(p, node, c);
+    case 'D':
+    case 'W':
+    case 'S':
+        {
+            // build the positive class separately and add its complement
+            regex_node_t tmp = { .type = NODE_CLASS };
+            escape_class(p, &tmp, c + ('a' - 'A'));
+            class_normalize(p, &tmp, 1);
+            for (size_t i = 0; i < tmp.range_count; ++i)
+                class_add(p, node, tmp.ranges[i].lo, tmp.ranges[i].hi);
+
+            return p->error ? -1 : 0;
+        }
+    case 'n': return class_add(p, node, '\n', '\n');
+    case 'r': return class_add(p, node, '\r', '\r');
+    case 't': return class_add(p, node, '\t', '\t');
+    case 'f': return class_add(p, node, '\f', '\f');
+    case 'v': return class_add(p, node, '\v', '\v');
+    case 'x':
+    case 'u':
+        {
+            int32_t value;
+            int digits;
+            if (c == 'x' && p->chr == '{')
+            {
+                parser_next(p);
+                digits = parse_hex(p, 6, &value);
+                if (p->chr != '}')
+                    digits = 0;
+
+                parser_next(p);
+            }
+            else digits = parse_hex(p, c == 'x' ? 2 : 4, &value);
+
+            if (digits == 0 || value > TEXTREGEX_MAX_CODE_POINT)
+            {
+                p->error = 1;
+                return -1;
+            }
+            return class_add(p, node, value, value);
+        }
+    }
+    return class_add(p, node, c, c);
+}
+
+static regex_node_t *parse_class(regex_parser_t *p)
+{
+    regex_node_t *node = new_node(p, NODE_CLASS, NULL, NULL);
+    if (node == NULL)
+        return NULL;
+
+    int negate = 0;
+    if (p->chr == '^')
+    {
+        negate = 1;
+        parser_next(p);
+    }
+    int first = 1;
+    while (!p->error && (p->chr != ']' || first))
+    {
+        first = 0;
+        int32_t lo = p->chr;
+        if (lo == EOF)
+        {
+            p->error = 1;
+            return NULL;
+        }
+        parser_next(p);
+        if (lo == '\\')
+        {
+            // escapes that turn into a single character can still start a range
+            regex_node_t tmp = { .type = NODE_CLASS };
+            if (parse_escape(p, &tmp) != 0)
+                return NULL;
+
+            if (tmp.range_count != 1 || tmp.ranges[0].lo != tmp.ranges[0].hi)
+            {
+                for (size_t i = 0; i < tmp.range_count; ++i)
+                    class_add(p, node, tmp.ranges[i].lo, tmp.ranges[i].hi);
+
+                continue;
+            }
+            lo = tmp.ranges[0].lo;
+        }
+        int32_t hi = lo;
+        if (p->chr == '-')
+        {
+            parser_next(p);
+            if (p->chr == ']')
+            {
+                // a '-' at the end is just a '-'
+                class_add(p, node, '-', '-');
+            }
+            else
+            {
+                hi = p->chr;
+                parser_next(p);
+                if (hi == '\\')
+                {
+                    regex_node_t tmp = { .type = NODE_CLASS };
+                    if (parse_escape(p, &tmp) != 0 || tmp.range_count != 1 || tmp.ranges[0].lo != tmp.ranges[0].hi)
+                    {
+                        p->error = 1;
+                        return NULL;
+                    }
+                    hi = tmp.ranges[0].lo;
+                }
+                if (hi == EOF || hi < lo)
+                {
+                    p->error = 1;
+                    return NULL;
+                }
+            }
+        }
+        class_add(p, node, lo, hi);
+    }
+    parser_next(p);
+    class_normalize(p, node, negate);
+    return node;
+}
+
+static regex_node_t *parse_alt(regex_parser_t *p);
+
+static regex_node_t *parse_atom(regex_parser_t *p)
+{
+    int32_t c = p->chr;
+    switch (c)
+    {
+    case '(':
+        {
+            parser_next(p);
+            if (p->chr == '?')
+            {
+                parser_next(p);
+                if (p->chr != ':')
+                {
+                    p->error = 1;
+                    return NULL;
+                }
+                parser_next(p);
+            }
+            ++p->depth;
+            regex_node_t *node = parse_alt(p);
+            --p->depth;
+            if (p->chr != ')')
+            {
+                p->error = 1;
+                return NULL;
+            }
+            parser_next(p);
+            return node;
+        }
+    case '[':
+        parser_next(p);
+        return parse_class(p);
+    case '.':
+        {
+            parser_next(p);
+            regex_node_t *node = new_node(p, NODE_CLASS, NULL, NULL);
+            if (node != NULL)
+            {
+                class_add(p, node, 0, '\n' - 1);
+                class_add(p, node, '\n' + 1, TEXTREGEX_MAX_CODE_POINT);
+            }
+            return node;
+        }
+    case '^':
+    case '$':
+        parser_next(p);
+        return new_node(p, c == '^' ? NODE_ASSERT_START : NODE_ASSERT_END, NULL, NULL);
+    case '*':
+    case '+':
+    case '?':
+        p->error = 1;
+        return NULL;
+    case '\\':
+        {
+            parser_next(p);
+            regex_node_t *node = new_node(p, NODE_CLASS, NULL, NULL);
+            if (node != NULL && parse_escape(p, node) == 0)
+                class_normalize(p, node, 0);
+
+            return node;
+        }
+    }
+    parser_next(p);
+    regex_node_t *node = new_node(p, NODE_CLASS, NULL, NULL);
+    if (node != NULL)
+        class_add(p, node, c, c);
+
+    return node;
+}
+
+static int parse_number(regex_parser_t *p, int *value)
+{
+    int digits = 0;
+    *value = 0;
+    while (p->chr >= '0' && p->chr <= '9')
+    {
+        *value = *value * 10 + (p->chr - '0');
+        if (*value > TEXTREGEX_MAX_REPEAT)
+            return -1;
+
+        ++digits;
+        parser_next(p);
+    }
+    return digits;
+}
+
+static regex_node_t *parse_repeat(regex_parser_t *p)
+{
+    regex_node_t *node = parse_atom(p);
+    // there's nothing to repeat in an anchor
+    if (node != NULL && (node->type == NODE_ASSERT_START || node->type == NODE_ASSERT_END)
+        && (p->chr == '*' || p->chr == '+' || p->chr == '?' || p->chr == '{'))
+    {
+        p->error = 1;
+        return NULL;
+    }
+    while (node != NULL && !p->error)
+    {
+        switch (p->chr)
+        {
+        case '*':
+            node = new_node(p, NODE_STAR, node, NULL);
+            break;
+        case '+':
+            node = new_node(p, NODE_PLUS, node, NULL);
+            break;
+        case '?':
+            node = new_node(p, NODE_QUEST, node, NULL);
+            break;
+        case '{':
+            {
+                parser_next(p);
+                int min, max;
+                if (parse_number(p, &min) <= 0)
+                {
+                    p->error = 1;
+                    return NULL;
+                }
+                max = min;
+                if (p->chr == ',')
+                {
+                    parser_next(p);
+                    int digits = parse_number(p, &max);
+                    if (digits < 0 || (digits > 0 && max < min))
+                    {
+                        p->error = 1;
+                        return NULL;
+                    }
+                    if (digits == 0)
+                        max = -1;
+                }
+                if (p->chr != '}')
+                {
+                    p->error = 1;
+                    return NULL;
+                }
+                // the same child node is used for every copy, it's compiled separately each time anyways
+                regex_node_t *child = node;
+                regex_node_t *rslt = new_node(p, NODE_EMPTY, NULL, NULL);
+                for (int i = 0; i < min && rslt != NULL; ++i)
+                    rslt = new_node(p, NODE_CONCAT, rslt, child);
+
+                if (max < 0 && rslt != NULL)
+                    rslt = new_node(p, NODE_CONCAT, rslt, new_node(p, NODE_STAR, child, NULL));
+
+                // x{0,3} is (x(x(x)?)?)?
+                regex_node_t *optional = NULL;
+                for (int i = min; i < max && rslt != NULL; ++i)
+                    optional = new_node(p, NODE_QUEST, optional == NULL ? child : new_node(p, NODE_CONCAT, child, optional), NULL);
+
+                if (optional != NULL)
+                    rslt = new_node(p, NODE_CONCAT, rslt, optional);
+
+                node = rslt;
+            }
+            break;
+        default:
+            return node;
+        }
+        parser_next(p);
+    }
+    return node;
+}
+
+static regex_node_t *parse_concat(regex_parser_t *p)
+{
+    regex_node_t *node = new_node(p, NODE_EMPTY, NULL, NULL);
+    while (node != NULL && !p->error && p->chr != EOF && p->chr != '|' && p->chr != ')')
+        node = new_node(p, NODE_CONCAT, node, parse_repeat(p));
+
+    return node;
+}
+
+static regex_node_t *parse_alt(regex_parser_t *p)
+{
+    regex_node_t *node = parse_concat(p);
+    while (node != NULL && !p->error && p->chr == '|')
+    {
+        parser_next(p);
+        node = new_node(p, NODE_ALT, node, parse_concat(p));
+    }
+    return node;
+}
+
+static int nfa_add(textregex_t *re, nfa_type_t type, uint8_t lo, uint8_t hi, int out, int out1)
+{
+    if (re->nfa_count >= re->nfa_capacity)
+    {
+        if (re->nfa_capacity >= TEXTREGEX_MAX_NFA_STATES)
+            return -1;
+
+        int capacity = re->nfa_capacity == 0 ? 64 : re->nfa_capacity * 2;
+        nfa_state_t *nfa = realloc(re->nfa, capacity * sizeof(nfa_state_t));
+        if (nfa == NULL)
+            return -1;
+
+        re->nfa = nfa;
+        re->nfa_capacity = capacity;
+    }
+    re->nfa[re->nfa_count] = (nfa_state_t){ .type = type, .lo = lo, .hi = hi, .out = out, .out1 = out1 };
+    return re->nfa_count++;
+}
+
+// adds the byte sequence lo[0..n] - hi[0..n] as an alternative in front of *start
+static int nfa_add_sequence(textregex_t *re, const uint8_t *lo, const uint8_t *hi, int n, int next, int *start)
+{
+    int state = next;
+    for (int i = n - 1; i >= 0 && state >= 0; --i)
+        state = nfa_add(re, NFA_RANGE, lo[i], hi[i], state, -1);
+
+    if (state < 0)
+        return -1;
+
+    *start = *start < 0 ? state : nfa_add(re, NFA_SPLIT, 0, 0, state, *start);
+    return *start < 0 ? -1 : 0;
+}
+
+/*
+ *  turns a code point range into utf-8 byte range sequences
+ *  the range is split until all the code points in each piece have the same length
+ *  and every byte of the piece can go through its whole range independently of the others
+ */
+static int nfa_add_utf8_range(textregex_t *re, int32_t lo, int32_t hi, int next, int *start)
+{
+    static const int32_t length_limits[] = { 0x7f, 0x7ff, 0xffff, TEXTREGEX_MAX_CODE_POINT };
+    if (lo > hi)
+        return 0;
+
+    // there's no utf-8 for surrogates
+    if (lo <= 0xdfff && hi >= 0xd800)
+    {
+        if (lo < 0xd800 && nfa_add_utf8_range(re, lo, 0xd7ff, next, start) != 0)
+            return -1;
+
+        return hi > 0xdfff ? nfa_add_utf8_range(re, 0xe000, hi, next, start) : 0;
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+        if (lo <= length_limits[i] && hi > length_limits[i])
+        {
+            if (nfa_add_utf8_range(re, lo, length_limits[i], next, start) != 0)
+                return -1;
+
+            return nfa_add_utf8_range(re, length_limits[i] + 1, hi, next, start);
+        }
+    }
+    uint8_t lo_bytes[4], hi_bytes[4];
+    int n = textprocessing_encode_chr(TPENC_UTF8, lo, lo_bytes);
+    textprocessing_encode_chr(TPENC_UTF8, hi, hi_bytes);
+    for (int i = 1; i < n; ++i)
+    {
+        int32_t mask = ((int32_t)1 << (6 * i)) - 1;
+        if ((lo & ~mask) != (hi & ~mask))
+        {
+            if ((lo & mask) != 0)
+            {
+                if (nfa_add_utf8_range(re, lo, lo | mask, next, start) != 0)
+                    return -1;
+
+                return nfa_add_utf8_range(re, (lo | mask) + 1, hi, next, start);
+            }
+            if ((hi & mask) != mask)
+            {
+                if (nfa_add_utf8_range(re, lo, (hi & ~mask) - 1, next, start) != 0)
+                    return -1;
+
+                return nfa_add_utf8_range(re, hi & ~mask, hi, next, start);
+            }
+        }
+    }
+    return nfa_add_sequence(re, lo_bytes, hi_bytes, n, next, start);
+}
+
+// compiles the node so that it continues to next once it's matched, returns the state it starts at
+static int nfa_compile(textregex_t *re, regex_node_t *node, int next)
+{
+    if (next < 0)
+        return -1;
+
+    switch (node->type)
+    {
+    case NODE_EMPTY:
+        return next;
+    case NODE_CLASS:
+        {
+            int start = -1;
+            for (size_t i = 0; i < node->range_count; ++i)
+            {
+                if (nfa_add_utf8_range(re, node->ranges[i].lo, node->ranges[i].hi, next, &start) != 0)
+                    return -1;
+            }
+            // a class that can't match anything (like [^\x{0}-\x{10ffff}])
+            if (start < 0)
+                start = nfa_add(re, NFA_RANGE, 1, 0, next, -1);
+
+            return start;
+        }
+    case NODE_CONCAT:
+        return nfa_compile(re, node->left, nfa_compile(re, node->right, next));
+    case NODE_ALT:
+        {
+            int left = nfa_compile(re, node->left, next);
+            int right = nfa_compile(re, node->right, next);
+            if (left < 0 || right < 0)
+                return -1;
+
+            return nfa_add(re, NFA_SPLIT, 0, 0, left, right);
+        }
+    case NODE_STAR:
+    case NODE_PLUS:
+        {
+            int split = nfa_add(re, NFA_SPLIT, 0, 0, -1, next);
+            if (split < 0)
+                return -1;
+
+            int body = nfa_compile(re, node->left, split);
+            if (body < 0)
+                return -1;
+
+            re->nfa[split].out = body;
+            return node->type == NODE_STAR ? split : body;
+        }
+    case NODE_QUEST:
+        {
+            int body = nfa_compile(re, node->left, next);
+            if (body < 0)
+                return -1;
+
+            return nfa_add(re, NFA_SPLIT, 0, 0, body, next);
+        }
+    case NODE_ASSERT_START:
+        return nfa_add(re, NFA_ASSERT_START, 0, 0, next, -1);
+    case NODE_ASSERT_END:
+        return nfa_add(re, NFA_ASSERT_END, 0, 0, next, -1);
+    }
+    return -1;
+}
+
+// collects the literal text every match has to start with, returns 0 once it can't continue
+static int regex_collect_prefix(textregex_t *re, regex_node_t *node)
+{
+    switch (node->type)
+    {
+    case NODE_EMPTY:
+    case NODE_ASSERT_START:
+    case NODE_ASSERT_END:
+        // anchors don't read anything, the literal after one still starts the match
+        return 1;
+    case NODE_CLASS:
+        {
+            if (node->range_count != 1 || node->ranges[0].lo != node->ranges[0].hi)
+                return 0;
+
+            uint8_t bytes[4];
+            int len = textprocessing_encode_chr(TPENC_UTF8, node->ranges[0].lo, bytes);
+            if (len < 0 || re->prefix_len + len > TEXTREGEX_MAX_PREFIX)
+                return 0;
+
+            memcpy(re->prefix + re->prefix_len, bytes, len);
+            re->prefix_len += len;
+            return 1;
+        }
+    case NODE_CONCAT:
+        return regex_collect_prefix(re, node->left) && regex_collect_prefix(re, node->right);
+    case NODE_PLUS:
+        regex_collect_prefix(re, node->left);
+        return 0;
+    default:
+        return 0;
+    }
+}
+
+textregex_t *textregex_compile(const char *pattern, size_t pattern_len)
+{
+    textregex_t *re = calloc(1, sizeof(textregex_t));
+    if (re == NULL)
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+    textprocessing_arena_t arena;
+    textprocessing_arena_init(&arena, 0);
+
+    regex_parser_t parser = {
+        .reader = textreader_openmem(pattern, pattern_len, TPENC_UTF8),
+        .arena = &arena
+    };
+    parser_next(&parser);
+    regex_node_t *root = parse_alt(&parser);
+    int syntax_error = root == NULL || parser.error || parser.chr != EOF;
+    textreader_close(&parser.reader, 0);
+    if (syntax_error)
+    {
+        textprocessing_arena_free(&arena);
+        textregex_free(re);
+        errno = EINVAL;
+        return NULL;
+    }
+
+    int match = nfa_add(re, NFA_MATCH, 0, 0, -1, -1);
+    re->nfa_start = nfa_compile(re, root, match);
+    regex_collect_prefix(re, root);
+
+    textprocessing_arena_free(&arena);
+    if (match < 0 || re->nfa_start < 0)
+    {
+        textregex_free(re);
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    re->set = malloc(re->nfa_count * sizeof(int));
+    re->stack = malloc(re->nfa_count * sizeof(int));
+    re->marks = calloc(re->nfa_count, sizeof(uint32_t));
+    re->start_state[0] = re->start_state[1] = re->restart_state = DFA_UNKNOWN;
+    if (re->set == NULL || re->stack == NULL || re->marks == NULL)
+    {
+        textregex_free(re);
+        errno = ENOMEM;
+        return NULL;
+    }
+    textregex_set_cache_states(re, TEXTREGEX_DEFAULT_CACHE_STATES);
+    if (re->states == NULL)
+    {
+        textregex_free(re);
+        errno = ENOMEM;
+        return NULL;
+    }
+    return re;
+}
+
+static void dfa_flush(textregex_t *re)
+{
+    for (int i = 0; i < re->state_count; ++i)
+        free(re->states[i].nfa);
+
+    re->state_count = 0;
+    re->start_state[0] = re->start_state[1] = re->restart_state = DFA_UNKNOWN;
+    ++re->flush_count;
+    for (int i = 0; i < re->hash_capacity; ++i)
+        re->hash_table[i] = -1;
+}
+
+void textregex_set_cache_states(textregex_t *re, size_t max_states)
+{
+    // a scan adds at most the next state and the restart state after a flush, so those always fit
+    if (max_states < 2)
+        max_states = 2;
+
+    if (re->states != NULL)
+        dfa_flush(re);
+
+    free(re->states);
+    free(re->hash_table);
+    re->max_states = (int)max_states;
+    re->hash_capacity = (int)max_states * 2;
+    re->states = malloc(max_states * sizeof(dfa_state_t));
+    re->hash_table = malloc(re->hash_capacity * sizeof(int));
+    if (re->states == NULL || re->hash_table == NULL)
+    {
+        free(re->states);
+        free(re->hash_table);
+        re->states = NULL;
+        re->hash_table = NULL;
+        re->max_states = 0;
+        re->hash_capacity = 0;
+        return;
+    }
+    for (int i = 0; i < re->hash_capacity; ++i)
+        re->hash_table[i] = -1;
+
+    re->state_count = 0;
+    re->start_state[0] = re->start_state[1] = re->restart_state = DFA_UNKNOWN;
+}
+
+void textregex_free(textregex_t *re)
+{
+    if (re == NULL)
+        return;
+
+    if (re->states != NULL)
+        dfa_flush(re);
+
+    free(re->states);
+    free(re->hash_table);
+    free(re->nfa);
+    free(re->set);
+    free(re->stack);
+    free(re->marks);
+    free(re);
+}
+
+// adds the state and everything reachable from it without reading a byte to re->set
+// states are marked when they're pushed so the stack never holds more than nfa_count of them
+// flags says which asserts can be passed, a ^ that can't be ends the thread and a $ that can't is kept in the set
+static void nfa_closure(textregex_t *re, int state, int *count, int flags)
+{
+    if (re->marks[state] == re->mark_generation)
+        return;
+
+    int top = 0;
+    re->marks[state] = re->mark_generation;
+    re->stack[top++] = state;
+    while (top > 0)
+    {
+        int s = re->stack[--top];
+        int type = re->nfa[s].type;
+        if (type == NFA_ASSERT_START && (flags & CLOSURE_AT_START) == 0)
+            continue;
+
+        if ((type == NFA_ASSERT_END && (flags & CLOSURE_AT_END) == 0) || type == NFA_RANGE || type == NFA_MATCH)
+        {
+            re->set[(*count)++] = s;
+            continue;
+        }
+        int outs[2] = { re->nfa[s].out1, re->nfa[s].out };
+        for (int i = type == NFA_SPLIT ? 0 : 1; i < 2; ++i)
+        {
+            if (re->marks[outs[i]] != re->mark_generation)
+            {
+                re->marks[outs[i]] = re->mark_generation;
+                re->stack[top++] = outs[i];
+            }
+        }
+    }
+}
+
+static void regex_next_generation(textregex_t *re)
+{
+    if (++re->mark_generation == 0)
+    {
+        memset(re->marks, 0, re->nfa_count * sizeof(uint32_t));
+        re->mark_generation = 1;
+    }
+}
+
+static int compare_ints(const void *a, const void *b)
+{
+    int ia = *(const int*)a, ib = *(const int*)b;
+    return (ia > ib) - (ia < ib);
+}
+
+// whether the NFA states get to a match when the text ends, re->set is used up for it
+static int dfa_match_at_end(textregex_t *re, const int *nfa, int nfa_count, int flags)
+{
+    int count = 0;
+    regex_next_generation(re);
+    for (int i = 0; i < nfa_count; ++i)
+        nfa_closure(re, nfa[i], &count, CLOSURE_AT_END | (flags & DFA_AT_START ? CLOSURE_AT_START : 0));
+
+    for (int i = 0; i < count; ++i)
+    {
+        if (re->nfa[re->set[i]].type == NFA_MATCH)
+            return 1;
+    }
+    return 0;
+}
+
+// finds the DFA state for the NFA states in re->set or makes a new one
+static int dfa_find_or_add(textregex_t *re, int count, int flags)
+{
+    if (count == 0)
+        return DFA_DEAD;
+
+    qsort(re->set, count, sizeof(int), compare_ints);
+    uint32_t hash = 2166136261u ^ (uint32_t)flags;
+    for (int i = 0; i < count; ++i)
+        hash = (hash ^ (uint32_t)re->set[i]) * 16777619u;
+
+    int slot = hash % re->hash_capacity;
+    for (; re->hash_table[slot] >= 0; slot = (slot + 1) % re->hash_capacity)
+    {
+        dfa_state_t *state = &re->states[re->hash_table[slot]];
+        if (state->hash == hash && state->flags == flags && state->nfa_count == count
+            && !memcmp(state->nfa, re->set, count * sizeof(int)))
+            return re->hash_table[slot];
+    }
+    if (re->state_count >= re->max_states)
+    {
+        dfa_flush(re);
+        return dfa_find_or_add(re, count, flags);
+    }
+    int *nfa = malloc(count * sizeof(int));
+    if (nfa == NULL)
+        return DFA_UNKNOWN;
+
+    memcpy(nfa, re->set, count * sizeof(int));
+    int index = re->state_count++;
+    dfa_state_t *state = &re->states[index];
+    state->nfa = nfa;
+    state->nfa_count = count;
+    state->hash = hash;
+    state->flags = flags;
+    state->is_match = 0;
+    for (int i = 0; i < count; ++i)
+        state->is_match |= re->nfa[nfa[i]].type == NFA_MATCH;
+
+    state->match_at_end = state->is_match || dfa_match_at_end(re, nfa, count, flags);
+
+    for (int i = 0; i < 256; ++i)
+        state->next[i] = DFA_UNKNOWN;
+
+    re->hash_table[slot] = index;
+    return index;
+}
+
+// anchored is for textregex_match, a search can start a new match after every byte
+static int dfa_start(textregex_t *re, int anchored)
+{
+    if (re->start_state[anchored] == DFA_UNKNOWN)
+    {
+        int count = 0;
+        regex_next_generation(re);
+        nfa_closure(re, re->nfa_start, &count, CLOSURE_AT_START);
+        re->start_state[anchored] = dfa_find_or_add(re, count, DFA_AT_START | (anchored ? DFA_ANCHORED : 0));
+    }
+    return re->start_state[anchored];
+}
+
+// the state of a search that has nothing partially matched after the start of the text
+static int dfa_restart(textregex_t *re)
+{
+    if (re->restart_state == DFA_UNKNOWN)
+    {
+        int count = 0;
+        regex_next_generation(re);
+        nfa_closure(re, re->nfa_start, &count, 0);
+        re->restart_state = dfa_find_or_add(re, count, 0);
+    }
+    return re->restart_state;
+}
+
+static int dfa_step(textregex_t *re, int state, uint8_t byte)
+{
+    int next = re->states[state].next[byte];
+    if (next != DFA_UNKNOWN)
+        return next;
+
+    int count = 0;
+    dfa_state_t *s = &re->states[state];
+    regex_next_generation(re);
+    for (int i = 0; i < s->nfa_count; ++i)
+    {
+        nfa_state_t *n = &re->nfa[s->nfa[i]];
+        if (n->type == NFA_RANGE && byte >= n->lo && byte <= n->hi)
+            nfa_closure(re, n->out, &count, 0);
+    }
+    // for a search a new match can start after every byte
+    int flags = s->flags & DFA_ANCHORED;
+    if (!flags)
+        nfa_closure(re, re->nfa_start, &count, 0);
+
+    size_t flush_count = re->flush_count;
+    next = dfa_find_or_add(re, count, flags);
+    // if the cache got flushed then the old state doesn't exist anymore
+    if (next != DFA_UNKNOWN && flush_count == re->flush_count)
+        s->next[byte] = next;
+
+    return next;
+}
+
+// finds the next place the literal prefix could start at
+static const uint8_t *regex_prefilter(const uint8_t *prefix, size_t prefix_len, const uint8_t *p, const uint8_t *end)
+{
+    if ((size_t)(end - p) < prefix_len)
+        return NULL;
+
+    if (prefix_len == 1)
+        return memchr(p, prefix[0], end - p);
+
+    const uint8_t *last = end - prefix_len;
+    #ifdef __SSE2__
+    // checks the first and last byte of the prefix at 16 positions at once
+    __m128i first = _mm_set1_epi8((char)prefix[0]);
+    __m128i final = _mm_set1_epi8((char)prefix[prefix_len - 1]);
+    for (; p + 16 <= last + 1; p += 16)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i*)p);
+        __m128i b = _mm_loadu_si128((const __m128i*)(p + prefix_len - 1));
+        int mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, final)));
+        while (mask != 0)
+        {
+            int bit = __builtin_ctz(mask);
+            if (!memcmp(p + bit + 1, prefix + 1, prefix_len - 2))
+                return p + bit;
+
+            mask &= mask - 1;
+        }
+    }
+    #endif
+    while (p <= last)
+    {
+        p = memchr(p, prefix[0], last - p + 1);
+        if (p == NULL)
+            return NULL;
+
+        if (!memcmp(p + 1, prefix + 1, prefix_len - 1))
+            return p;
+
+        ++p;
+    }
+    return NULL;
+}
+
+/*
+ *  runs the DFA over the bytes
+ *  returns 1 when it finds a match (end is where it ends), 0 if there's none, -1 if it ran out of memory
+ *  with stop_at_match off it only says whether the state is matching at the end of the text
+ */
+static int regex_run(textregex_t *re, const uint8_t *text, size_t len, int anchored, int stop_at_match, size_t *end)
+{
+    // the restart state is made before the start state, if that one flushes the cache there's room for it again
+    int prefilter = re->prefix_len > 0 && !anchored;
+    if (prefilter && dfa_restart(re) == DFA_UNKNOWN)
+        return -1;
+
+    int state = dfa_start(re, anchored);
+    if (state == DFA_UNKNOWN || (prefilter && dfa_restart(re) == DFA_UNKNOWN))
+        return -1;
+
+    if (stop_at_match && re->states[state].is_match)
+    {
+        *end = 0;
+        return 1;
+    }
+    const uint8_t *p = text;
+    const uint8_t *text_end = text + len;
+    while (p < text_end)
+    {
+        // nothing is partially matched in the restart state so it's safe to skip to where the prefix is
+        if (prefilter && state == re->restart_state)
+        {
+            p = regex_prefilter(re->prefix, re->prefix_len, p, text_end);
+            if (p == NULL)
+                return 0;
+        }
+        size_t flush_count = re->flush_count;
+        state = dfa_step(re, state, *p++);
+        if (state == DFA_DEAD)
+            return 0;
+
+        if (state == DFA_UNKNOWN)
+            return -1;
+
+        // the restart state is made again after a flush so the prefilter keeps working,
+        // the cache only has the state that was just added in it so this can't flush it again
+        if (prefilter && flush_count != re->flush_count && dfa_restart(re) == DFA_UNKNOWN)
+            return -1;
+
+        if (stop_at_match && re->states[state].is_match)
+        {
+            *end = p - text;
+            return 1;
+        }
+    }
+    // a $ only gets passed through here
+    if (re->states[state].match_at_end)
+    {
+        *end = len;
+        return 1;
+    }
+    return 0;
+}
+
+int textregex_search(textregex_t *re, const void *text, size_t len, size_t *match_end)
+{
+    size_t end;
+    int rv = regex_run(re, text, len, 0, 1, &end);
+    if (rv == 1 && match_end != NULL)
+        *match_end = end;
+
+    return rv;
+}
+
+int textregex_match(textregex_t *re, const void *text, size_t len)
+{
+    // a whole match is a run that's anchored at the start and checked at the end,
+    // its states are cached next to the ones searches use
+    size_t end;
+    return regex_run(re, text, len, 1, 0, &end);
+}
+
+// state for feeding the DFA one character at a time
+typedef struct regex_stream
+{
+    int state;
+    int matched;
+} regex_stream_t;
+
+static int regex_stream_start(textregex_t *re, regex_stream_t *stream)
+{
+    stream->state = dfa_start(re, 0);
+    stream->matched = stream->state >= 0 && re->states[stream->state].is_match;
+    return stream->state == DFA_UNKNOWN ? -1 : 0;
+}
+
+// returns 1 on a match, 0 to keep going, -1 if the DFA died or ran out of memory
+static int regex_stream_feed(textregex_t *re, regex_stream_t *stream, int32_t chr)
+{
+    uint8_t bytes[4];
+    int len = textprocessing_encode_chr(TPENC_UTF8, chr, bytes);
+    if (len < 0)
+    {
+        // not something that can be in utf-8, it can't match anything
+        len = 1;
+        bytes[0] = 0xff;
+    }
+    for (int i = 0; i < len; ++i)
+    {
+        stream->state = dfa_step(re, stream->state, bytes[i]);
+        if (stream->state < 0)
+            return -1;
+    }
+    if (re->states[stream->state].is_match)
+        stream->matched = 1;
+
+    return stream->matched;
+}
+
+int textregex_search_codepoints(textregex_t *re, const int32_t *text, size_t count, size_t *match_end)
+{
+    regex_stream_t stream;
+    if (regex_stream_start(re, &stream) != 0)
+        return -1;
+
+    size_t i = 0;
+    for (; i < count && !stream.matched; ++i)
+    {
+        int rv = regex_stream_feed(re, &stream, text[i]);
+        if (rv < 0)
+            return stream.state == DFA_DEAD ? 0 : -1;
+    }
+    // a $ only gets passed through at the end
+    if (!stream.matched)
+        stream.matched = re->states[stream.state].match_at_end;
+
+    if (stream.matched && match_end != NULL)
+        *match_end = i;
+
+    return stream.matched;
+}
+
+int textregex_search_reader(textregex_t *re, textreader_t *reader)
+{
+    if ((reader->flags & TRFLG_ISMEM) && reader->total_ungetc_count == 0 && reader->ungetc_stack.size == 0
+        && (reader->encoding == TPENC_UTF8 || reader->encoding == TPENC_ASCII)
+        && reader->data.mem.index <= reader->data.mem.size)
+    {
+        size_t start = reader->data.mem.index;
+        size_t end;
+        int rv = textregex_search(re, (const uint8_t*)reader->data.mem.mem + start, reader->data.mem.size - start, &end);
+        if (rv < 0)
+            return -1;
+
+        // seeking keeps the position tracking right
+        textreader_seeko(reader, rv == 1 ? (off_t)(start + end) : (off_t)reader->data.mem.size, SEEK_SET);
+        if (rv == 0)
+            reader->flags |= TRFLG_EOF;
+
+        return rv;
+    }
+
+    regex_stream_t stream;
+    if (regex_stream_start(re, &stream) != 0)
+        return -1;
+
+    if (stream.matched)
+        return 1;
+
+    int32_t chr;
+    while ((chr = textreader_getc(reader)) != EOF)
+    {
+        int rv = regex_stream_feed(re, &stream, chr);
+        if (rv == 1)
+            return 1;
+
+        if (rv < 0)
+        {
+            if (stream.state != DFA_DEAD)
+                return -1;
+
+            // a pattern that can only match at the start failed there
+            return 0;
+        }
+    }
+    if (textreader_error(reader))
+        return -1;
+
+    return re->states[stream.state].match_at_end;
+}
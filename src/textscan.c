@@ -0,0 +1,505 @@
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #include <tmmintrin.h>
+    #define TEXTSCAN_HAVE_SSSE3
+#endif
+
+#include <textprocessing/textscan.h>
+
+#define TEXTSCAN_MIN_SCRATCH 256
+
+/*
+ *  the ascii part of the set is also kept as two 16 byte tables for pshufb:
+ *      nibble_lo[b & 15] has bit (b >> 4) set if b is in the set
+ *      nibble_hi[h] is 1 << h for h < 8 and 0 for the non ascii high nibbles
+ *  so a byte is in the set when nibble_lo[b & 15] & nibble_hi[b >> 4] isn't 0
+ */
+
+void textreader_delimset_init(textreader_delimset_t *set)
+{
+    memset(set, 0, sizeof(*set));
+    for (int h = 0; h < 8; ++h)
+        set->nibble_hi[h] = 1 << h;
+}
+
+void textreader_delimset_free(textreader_delimset_t *set)
+{
+    free(set->ranges);
+    set->ranges = NULL;
+    set->range_count = 0;
+}
+
+static void textscan_add_ascii(textreader_delimset_t *set, int32_t lo, int32_t hi)
+{
+    for (int32_t c = lo; c <= hi; ++c)
+    {
+        set->ascii[c >> 6] |= (uint64_t)1 << (c & 63);
+        set->nibble_lo[c & 15] |= 1 << (c >> 4);
+    }
+}
+
+int textreader_delimset_add_range(textreader_delimset_t *set, int32_t lo, int32_t hi)
+{
+    if (lo < 0 || hi > 0x10ffff || lo > hi)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    if (lo < 0x80)
+    {
+        textscan_add_ascii(set, lo, hi < 0x80 ? hi : 0x7f);
+        if (hi < 0x80)
+            return 0;
+
+        lo = 0x80;
+    }
+
+    // the ranges are kept sorted and merged so contains can binary search them
+    size_t first = 0;
+    while (first < set->range_count && set->ranges[first].hi < lo - 1)
+        ++first;
+
+    size_t last = first;
+    while (last < set->range_count && set->ranges[last].lo <= hi + 1)
+    {
+        if (set->ranges[last].lo < lo)
+            lo = set->ranges[last].lo;
+        if (set->ranges[last].hi > hi)
+            hi = set->ranges[last].hi;
+        ++last;
+    }
+
+    if (first == last)
+    {
+        struct textreader_delimset_range *new_ranges = realloc(set->ranges, (set->range_count + 1) * sizeof(*new_ranges));
+        if (new_ranges == NULL)
+        {
+            errno = ENOMEM;
+            return -1;
+        }
+        set->ranges = new_ranges;
+        memmove(set->ranges + first + 1, set->ranges + first, (set->range_count - first) * sizeof(*new_ranges));
+        ++set->range_count;
+    }
+    else
+    {
+        memmove(set->ranges + first + 1, set->ranges + last, (set->range_count - last) * sizeof(*set->ranges));
+        set->range_count -= last - first - 1;
+    }
+    set->ranges[first].lo = lo;
+    set->ranges[first].hi = hi;
+    return 0;
+}
+
+int textreader_delimset_add(textreader_delimset_t *set, int32_t chr)
+{
+    return textreader_delimset_add_range(set, chr, chr);
+}
+
+int textreader_delimset_add_string(textreader_delimset_t *set, const char *chars)
+{
+    size_t len = strlen(chars);
+    size_t i = 0;
+    while (i < len)
+    {
+        int32_t chr;
+        int got = textprocessing_decode_chr(TPENC_UTF8, (const uint8_t*)chars + i, len - i, &chr);
+        if (got <= 0)
+        {
+            errno = EILSEQ;
+            return -1;
+        }
+        if (textreader_delimset_add(set, chr) != 0)
+            return -1;
+
+        i += got;
+    }
+    return 0;
+}
+
+int textreader_delimset_contains(const textreader_delimset_t *set, int32_t chr)
+{
+    if (chr < 0)
+        return 0;
+
+    if (chr < 0x80)
+        return (set->ascii[chr >> 6] >> (chr & 63)) & 1;
+
+    size_t lo = 0, hi = set->range_count;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (chr < set->ranges[mid].lo)
+            hi = mid;
+        else if (chr > set->ranges[mid].hi)
+            lo = mid + 1;
+        else return 1;
+    }
+    return 0;
+}
+
+/*
+ *  finds the first byte that has to be looked at, which is
+ *      an ascii byte that's in the set (until) or not in the set (!until)
+ *      any non ascii byte if high_bytes is set or when skipping (they aren't in the ascii part of the set)
+ *  returns len if there isn't one
+ */
+static size_t textscan_find_scalar(const uint8_t *p, size_t len, const textreader_delimset_t *set, int until, int high_bytes)
+{
+    for (size_t i = 0; i < len; ++i)
+    {
+        uint8_t c = p[i];
+        if (c >= 0x80)
+        {
+            if (high_bytes || !until)
+                return i;
+        }
+        else if ((int)((set->ascii[c >> 6] >> (c & 63)) & 1) == until)
+            return i;
+    }
+    return len;
+}
+
+#ifdef TEXTSCAN_HAVE_SSSE3
+__attribute__((target("ssse3")))
+static size_t textscan_find_ssse3(const uint8_t *p, size_t len, const textreader_delimset_t *set, int until, int high_bytes)
+{
+    const __m128i lo_table = _mm_loadu_si128((const __m128i*)set->nibble_lo);
+    const __m128i hi_table = _mm_loadu_si128((const __m128i*)set->nibble_hi);
+    const __m128i low_nibble = _mm_set1_epi8(0x0f);
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16)
+    {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(p + i));
+        __m128i lo = _mm_shuffle_epi8(lo_table, _mm_and_si128(bytes, low_nibble));
+        __m128i hi = _mm_shuffle_epi8(hi_table, _mm_and_si128(_mm_srli_epi16(bytes, 4), low_nibble));
+
+        // the non ascii bytes are never members since their high nibble entries are 0
+        unsigned int not_member = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi), zero));
+        unsigned int hits = until ? ~not_member & 0xffff : not_member;
+        if (until && high_bytes)
+            hits |= _mm_movemask_epi8(bytes);
+
+        if (hits)
+            return i + __builtin_ctz(hits);
+    }
+    return i + textscan_find_scalar(p + i, len - i, set, until, high_bytes);
+}
+#endif
+
+static size_t textscan_find(const uint8_t *p, size_t len, const textreader_delimset_t *set, int until, int high_bytes)
+{
+#ifdef TEXTSCAN_HAVE_SSSE3
+    if (__builtin_cpu_supports("ssse3"))
+        return textscan_find_ssse3(p, len, set, until, high_bytes);
+#endif
+    return textscan_find_scalar(p, len, set, until, high_bytes);
+}
+
+static int textscan_reserve(textreader_t *reader, size_t size)
+{
+    if (size <= reader->scratch_capacity)
+        return 0;
+
+    size_t new_capacity = reader->scratch_capacity ? reader->scratch_capacity : TEXTSCAN_MIN_SCRATCH;
+    while (new_capacity < size)
+        new_capacity *= 2;
+
+    void *new_scratch = realloc(reader->scratch, new_capacity);
+    if (new_scratch == NULL)
+    {
+        errno = ENOMEM;
+        return -1;
+    }
+    reader->scratch = new_scratch;
+    reader->scratch_capacity = new_capacity;
+    return 0;
+}
+
+static int textscan_append(textreader_t *reader, size_t *used, const void *data, size_t len)
+{
+    if (len == 0)
+        return 0;
+
+    if (textscan_reserve(reader, *used + len) != 0)
+        return -1;
+
+    memcpy((uint8_t*)reader->scratch + *used, data, len);
+    *used += len;
+    return 0;
+}
+
+/*
+ *  goes through textreader_getc and puts the stopping character back with textreader_ungetc,
+ *  that's only for characters that were pushed back and for readers of a FILE without prefetching
+ *  the text that was read is re-encoded into the scratch buffer (if used isn't NULL)
+ *  returns 2 once the pushed back characters are used up and the rest of the text is in memory
+ */
+static int textscan_generic(textreader_t *reader, const textreader_delimset_t *set, int until, size_t *used)
+{
+    for (;;)
+    {
+        if (reader->ungetc_stack.size == 0 && reader->total_ungetc_count == 0
+            && (((reader->flags & TRFLG_ISMEM) && reader->data.mem.index <= reader->data.mem.size) || reader->window != NULL))
+            return 2;
+
+        int32_t chr = textreader_getc(reader);
+        if (chr == EOF)
+            return textreader_error(reader) ? -1 : 0;
+
+        if (textreader_delimset_contains(set, chr) == until)
+            return textreader_ungetc(reader, chr) != 0 ? -1 : 1;
+
+        if (used == NULL)
+            continue;
+
+        if (textscan_reserve(reader, *used + 4) != 0)
+            return -1;
+
+        int len = textprocessing_encode_chr(reader->encoding, chr, (uint8_t*)reader->scratch + *used);
+        // the replacement character can't be encoded in the single byte encodings
+        if (len < 0)
+        {
+            ((uint8_t*)reader->scratch)[*used] = '?';
+            len = 1;
+        }
+        *used += len;
+    }
+}
+
+/*
+ *  classifies the text in [*pos, size) without going through the reader, *pos is left where it stopped
+ *  returns 1 at a character that ends the scan, 0 at the end of the text
+ *  and at a sequence that has to be decoded by getc -1 if it's invalid or -2 if it's cut off by the end
+ */
+static int textscan_block(textprocessing_encoding_t enc, const textreader_delimset_t *set, int until, const uint8_t *mem, size_t size, size_t *pos)
+{
+    // with a byte encoding the bytes can be classified without decoding them,
+    // the non ascii ones only have to be decoded if there are non ascii characters in the set
+    // (or if they're invalid in the first place)
+    int byte_encoding = enc == TPENC_UTF8 || enc == TPENC_ASCII || enc == TPENC_LATIN1 || enc == TPENC_CP1252;
+    int high_bytes = set->range_count != 0 || enc == TPENC_ASCII;
+
+    size_t p = *pos;
+    int rv = 0;
+    while (p < size)
+    {
+        if (byte_encoding)
+        {
+            p += textscan_find(mem + p, size - p, set, until, high_bytes);
+            if (p >= size)
+                break;
+
+            if (mem[p] < 0x80)
+            {
+                rv = 1;
+                break;
+            }
+        }
+
+        int32_t chr;
+        int got = textprocessing_decode_chr(enc, mem + p, size - p, &chr);
+        if (got <= 0)
+        {
+            rv = got < 0 ? -1 : -2;
+            break;
+        }
+        if (textreader_delimset_contains(set, chr) == until)
+        {
+            rv = 1;
+            break;
+        }
+        p += got;
+    }
+    *pos = p;
+    return rv;
+}
+
+static int textscan_mem(textreader_t *reader, const textreader_delimset_t *set, int until, textreader_view_t *out_view, size_t *used)
+{
+    const uint8_t *mem = reader->data.mem.mem;
+    size_t size = reader->data.mem.size;
+    size_t start = reader->data.mem.index;
+    size_t pos = start;
+    int stopped;
+    for (;;)
+    {
+        stopped = textscan_block(reader->encoding, set, until, mem, size, &pos);
+        if (stopped >= 0)
+            break;
+
+        // getc deals with invalid and cut off sequences (an error or a replacement character),
+        // a replacement character that ends the scan is left where it is so it doesn't have to be pushed back
+        if ((reader->flags & TRFLG_REPLACE_INVALID) && textreader_delimset_contains(set, TEXTREADER_REPLACEMENT_CHARACTER) == until)
+        {
+            stopped = 1;
+            break;
+        }
+        textreader_seeko(reader, (off_t)pos, SEEK_SET);
+        if (textreader_getc(reader) == EOF)
+        {
+            if (textreader_error(reader))
+                return -1;
+
+            stopped = 0;
+            break;
+        }
+        pos = reader->data.mem.index;
+    }
+
+    // seeking keeps the position tracking right
+    textreader_seeko(reader, (off_t)pos, SEEK_SET);
+    if (!stopped)
+        reader->flags |= TRFLG_EOF;
+
+    if (out_view != NULL)
+    {
+        // characters that were pushed back before this are already in the scratch buffer
+        if (*used != 0)
+        {
+            if (textscan_append(reader, used, mem + start, pos - start) != 0)
+                return -1;
+
+            out_view->data = reader->scratch;
+            out_view->size = *used;
+        }
+        else
+        {
+            out_view->data = mem + start;
+            out_view->size = pos - start;
+        }
+    }
+    return stopped;
+}
+
+/*
+ *  prefetched blocks are classified in place like memory is
+ *  the view points into the block unless the scan went past the end of it, then the text is copied into the scratch buffer
+ */
+static int textscan_window(textreader_t *reader, const textreader_delimset_t *set, int until, textreader_view_t *out_view, size_t *used)
+{
+    textreader_window_t *window = reader->window;
+    size_t view_start = window->index;
+    int copying = *used != 0;
+    int stopped;
+    for (;;)
+    {
+        size_t start = window->index;
+        size_t pos = start;
+        stopped = textscan_block(reader->encoding, set, until, window->data, window->size, &pos);
+        if (out_view != NULL && (copying || stopped != 1))
+        {
+            if (textscan_append(reader, used, window->data + start, pos - start) != 0)
+                return -1;
+
+            copying = 1;
+        }
+        window->index = pos;
+        if (stopped == 1)
+            break;
+
+        if (stopped == 0)
+        {
+            // getting a byte moves on to the next block
+            if (textreader_get_byte(reader) == EOF)
+            {
+                if (textreader_error(reader))
+                    return -1;
+
+                break;
+            }
+            --window->index;
+            continue;
+        }
+        // a replacement character that ends the scan is left where it is, like in memory
+        if (stopped == -1 && (reader->flags & TRFLG_REPLACE_INVALID)
+            && textreader_delimset_contains(set, TEXTREADER_REPLACEMENT_CHARACTER) == until)
+        {
+            stopped = 1;
+            break;
+        }
+        // the sequence goes through getc, the end of the block it could be in is kept because the block gets reused
+        off_t offset = textreader_tello(reader);
+        textreader_seeko(reader, offset, SEEK_SET);
+        const uint8_t *block = window->data;
+        uint8_t tail[4];
+        size_t tail_len = window->size - pos < sizeof(tail) ? window->size - pos : sizeof(tail);
+        memcpy(tail, block + pos, tail_len);
+
+        int32_t chr = textreader_getc(reader);
+        if (chr == EOF)
+        {
+            if (textreader_error(reader))
+                return -1;
+
+            stopped = 0;
+            break;
+        }
+        if (textreader_delimset_contains(set, chr) == until)
+        {
+            // only a character that was cut off by the end of the block gets here, at the end of the text it's still
+            // in the block, otherwise the block it started in is gone so it's put back (the next scan gets it from the pushback)
+            if (window->data == block ? textreader_seeko(reader, offset, SEEK_SET) != 0 : textreader_ungetc(reader, chr) != 0)
+                return -1;
+
+            stopped = 1;
+            break;
+        }
+        if (out_view == NULL)
+            continue;
+
+        if (window->data == block)
+        {
+            if (textscan_append(reader, used, block + pos, window->index - pos) != 0)
+                return -1;
+        }
+        else if (textscan_append(reader, used, tail, tail_len) != 0 || textscan_append(reader, used, window->data, window->index) != 0)
+            return -1;
+    }
+    if (out_view != NULL)
+    {
+        out_view->data = copying ? reader->scratch : window->data + view_start;
+        out_view->size = copying ? *used : window->index - view_start;
+    }
+
+    // seeking keeps the position tracking right, inside of the block it doesn't read anything
+    if (reader->ungetc_stack.size == 0)
+        textreader_seeko(reader, textreader_tello(reader), SEEK_SET);
+
+    if (!stopped)
+        reader->flags |= TRFLG_EOF;
+
+    return stopped;
+}
+
+static int textscan(textreader_t *reader, const textreader_delimset_t *set, int until, textreader_view_t *out_view)
+{
+    size_t used = 0;
+    int rv = textscan_generic(reader, set, until, out_view != NULL ? &used : NULL);
+    if (rv == 2)
+    {
+        return (reader->flags & TRFLG_ISMEM) ? textscan_mem(reader, set, until, out_view, &used)
+                                             : textscan_window(reader, set, until, out_view, &used);
+    }
+    if (rv >= 0 && out_view != NULL)
+    {
+        out_view->data = reader->scratch;
+        out_view->size = used;
+    }
+    return rv;
+}
+
+int textreader_scan_until(textreader_t *reader, const textreader_delimset_t *delimiter_set, textreader_view_t *out_view)
+{
+    return textscan(reader, delimiter_set, 1, out_view);
+}
+
+int textreader_skip_while(textreader_t *reader, const textreader_delimset_t *delimiter_set, textreader_view_t *out_view)
+{
+    return textscan(reader, delimiter_set, 0, out_view);
+}
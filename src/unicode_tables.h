@@ -0,0 +1,1677 @@
+// generated by tools/generate_unicode_tables.py, don't edit it by hand
+// unicode version 14.0.0
+
+#ifndef UNICODE_TABLES_H_INCLUDED
+#define UNICODE_TABLES_H_INCLUDED
+
+#include <stdint.h>
+
+#define UNICODE_TABLES_VERSION "14.0.0"
+
+/*
+ *  normalization properties, looked up through a two stage table:
+ *      record = unicode_norm_records[unicode_norm_stage2[(unicode_norm_stage1[cp >> UNICODE_NORM_SHIFT] << UNICODE_NORM_SHIFT) + (cp & UNICODE_NORM_MASK)]]
+ *  code points from UNICODE_NORM_LIMIT on all use record 0
+ *
+ *  decomposition is an index into unicode_norm_decompositions where the length is followed by the code points
+ *  of the full canonical decomposition (0 if there isn't one, hangul syllables are decomposed algorithmically)
+ */
+#define UNICODE_NORM_SHIFT 6
+#define UNICODE_NORM_MASK 63
+#define UNICODE_NORM_LIMIT 0x2fa40
+
+struct unicode_norm_record
+{
+    uint8_t ccc;
+    uint8_t flags;
+    uint16_t decomposition;
+};
+
+static const uint8_t unicode_norm_stage1[3049] = {
+    0, 0, 0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 7, 8, 9, 10, 11, 12, 13, 14, 0, 0, 15, 16, 17, 18, 0, 19, 20, 21, 0, 22,
+    23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 29, 35, 36, 37, 33, 38, 33, 39, 40, 41, 0, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 0, 52, 0, 0, 53, 54, 55, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 0, 58,
+    0, 0, 59, 0, 60, 0, 0, 0, 61, 62, 63, 64, 65, 66, 67, 68, 69, 0, 0, 70, 0, 0, 0, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 0, 0, 81, 82, 0, 83, 84, 85, 86, 87, 88, 89, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 0, 0, 0, 0, 0, 0, 0, 91, 0, 92, 0, 93, 0, 0, 0, 0, 0, 0, 0, 0,
+    94, 95, 96, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 98, 99, 100, 0, 0, 0, 0,
+    101, 0, 0, 102, 103, 104, 105, 106, 0, 0, 107, 108, 0, 0, 0, 109, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 111, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 122, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 123, 0, 0, 0, 124, 0, 125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 126, 0, 0, 127, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 129, 0, 0, 130, 131, 0,
+    0, 132, 133, 0, 134, 105, 0, 135, 136, 0, 0, 137, 138, 139, 0, 0, 0, 140, 141, 142, 0, 0, 143, 144, 92, 0, 145, 0, 146, 0, 0, 0,
+    147, 0, 0, 0, 148, 149, 0, 150, 151, 152, 153, 0, 0, 0, 0, 0, 92, 0, 0, 0, 0, 154, 155, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 156, 157, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 158,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 159, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 160, 161, 162, 0, 163, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    164, 0, 0, 0, 157, 0, 0, 0, 0, 0, 165, 166, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 167, 0, 168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    169, 170, 171, 172, 173, 174, 175, 176, 177,
+};
+
+static const uint16_t unicode_norm_stage2[11392] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 0, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 16, 17, 18, 19, 20, 21, 0, 0, 22, 23, 24, 25, 26, 0, 0,
+    27, 28, 29, 30, 31, 32, 0, 33, 34, 35, 36, 37, 38, 39, 40, 41, 0, 42, 43, 44, 45, 46, 47, 0, 0, 48, 49, 50, 51, 52, 0, 53,
+    54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 0, 0, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+    84, 85, 86, 87, 88, 89, 0, 0, 90, 91, 92, 93, 94, 95, 96, 97, 98, 0, 0, 0, 99, 100, 101, 102, 0, 103, 104, 105, 106, 107, 108, 0,
+    0, 0, 0, 109, 110, 111, 112, 113, 114, 0, 0, 0, 115, 116, 117, 118, 119, 120, 0, 0, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 0, 0, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    162, 163, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 164, 165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 0, 182, 183,
+    184, 185, 186, 187, 0, 0, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 0, 0, 0, 199, 200, 0, 0, 201, 202, 203, 204, 205, 206, 207, 208,
+    209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 0, 0, 237, 238,
+    0, 0, 0, 0, 0, 0, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    253, 253, 253, 253, 253, 254, 253, 253, 253, 253, 253, 253, 253, 254, 254, 253, 254, 253, 254, 253, 253, 255, 256, 256, 256, 256, 255, 257, 256, 256, 256, 256,
+    256, 258, 258, 259, 259, 259, 259, 260, 260, 256, 256, 256, 256, 259, 259, 256, 259, 259, 256, 256, 261, 261, 261, 261, 262, 256, 256, 256, 256, 254, 254, 254,
+    263, 264, 253, 265, 266, 267, 254, 256, 256, 256, 254, 254, 254, 256, 256, 0, 254, 254, 254, 256, 256, 256, 256, 254, 255, 256, 256, 254, 268, 269, 269, 268,
+    269, 269, 268, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 0, 0, 0, 0, 270, 0, 0, 0, 0, 0, 0, 0, 0, 0, 271, 0,
+    0, 0, 0, 0, 0, 272, 273, 274, 275, 276, 277, 0, 278, 0, 279, 280, 281, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 282, 283, 284, 285, 286, 287, 288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 289, 290, 291, 292, 293, 0, 0, 0, 0, 294, 295, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    296, 297, 0, 298, 0, 0, 0, 299, 0, 0, 0, 0, 300, 301, 302, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 303, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 306, 0, 307, 0, 0, 0, 308, 0, 0, 0, 0, 309, 310, 311, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 312, 313, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 254, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 314, 315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 316, 317, 318, 319, 0, 0, 320, 321, 0, 0, 322, 323, 324, 325, 326, 327,
+    0, 0, 328, 329, 330, 331, 332, 333, 0, 0, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 0, 0, 346, 347, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 254, 254, 254, 254, 256, 254, 254, 254, 348, 256, 254, 254, 254, 254,
+    254, 254, 256, 256, 256, 256, 256, 256, 254, 254, 256, 254, 254, 348, 349, 254, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 359, 360, 361, 362, 0, 363,
+    0, 364, 365, 0, 254, 256, 0, 358, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 254, 254, 254, 254, 366, 367, 368, 0, 0, 0, 0, 0,
+    0, 0, 369, 370, 371, 372, 373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 374, 375, 376, 366, 367, 368, 377, 378, 253, 253, 259, 256, 254, 254, 254, 254, 254, 256, 254, 254, 256,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 379, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    380, 0, 381, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 382, 0, 0, 254, 254, 254, 254, 254, 254, 254, 0, 0, 254,
+    254, 254, 254, 256, 254, 0, 0, 254, 254, 0, 256, 254, 254, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 383, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 256, 254, 254, 256, 254, 254, 256, 256, 256, 254, 256, 256, 254, 256, 254,
+    254, 254, 256, 254, 256, 254, 256, 254, 256, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 254, 254, 254, 256, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 0, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 0, 254, 254, 254, 0, 254, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 256, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 256, 256, 256, 254, 254, 254, 254,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 254, 256, 256, 256, 256, 256, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 0, 256, 254, 254, 256, 254, 254, 256, 254, 254, 254, 256, 256, 256, 374, 375, 376, 254, 254, 254, 256, 254, 254, 256, 256, 254, 254, 254, 254, 254,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 384, 0, 0, 0, 0, 0, 0, 0, 385, 0, 0, 386, 0, 0, 0, 0, 0, 0, 0, 387, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 254, 256, 254, 254, 0, 0, 0, 389, 390, 391, 392, 393, 394, 395, 396,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 0, 398, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 399, 400, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 401, 402, 0, 403,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 404, 0, 0, 405, 0, 0, 0, 0, 0, 397, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 407, 408, 0, 0, 409, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 410, 0, 0, 411, 412, 388, 0, 0, 0, 0, 0, 0, 0, 0, 398, 398, 0, 0, 0, 0, 413, 414, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 415, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 416, 417, 418, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 419, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 420, 421, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    422, 0, 398, 0, 0, 0, 0, 423, 424, 0, 425, 426, 0, 388, 0, 0, 0, 0, 0, 0, 0, 398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 388, 0, 398, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 427, 428, 429, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 430, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 431, 0, 432, 433, 434, 398,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 435, 435, 388, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 436, 436, 436, 436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 437, 437, 388, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 438, 438, 438, 438, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 256, 0, 439, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 440, 0, 0, 0, 0, 0, 0, 0, 0, 0, 441, 0, 0, 0, 0, 442, 0, 0, 0, 0, 443, 0, 0, 0, 0, 444, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 445, 0, 0, 0, 0, 0, 0, 0, 446, 447, 448, 449, 450, 451, 0, 452, 0, 447, 447, 447, 447, 0, 0,
+    447, 453, 254, 254, 388, 0, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 454, 0, 0, 0, 0, 0, 0, 0, 0, 0, 455, 0, 0,
+    0, 0, 456, 0, 0, 0, 0, 457, 0, 0, 0, 0, 458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 460, 0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 0, 0, 397, 0, 388, 388, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+    398, 398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 349, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 348, 254, 256, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 256, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 254, 254, 254, 254, 0, 0, 256,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 254, 256, 256, 256, 256, 256, 256, 254, 254, 256, 0, 256,
+    256, 254, 254, 256, 256, 254, 254, 254, 254, 254, 256, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 461, 0, 462, 0, 463, 0, 464, 0, 465, 0, 0, 0, 466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 398, 0, 0, 0, 0, 0, 467, 0, 468, 0, 0,
+    469, 470, 0, 471, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 256, 254, 254, 254, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 0, 261, 256, 256, 256, 256, 256, 254, 254, 256, 256, 256, 256,
+    254, 0, 261, 261, 261, 261, 261, 261, 261, 0, 0, 0, 0, 256, 0, 0, 0, 0, 0, 0, 254, 0, 0, 0, 254, 254, 0, 0, 0, 0, 0, 0,
+    254, 254, 256, 254, 254, 254, 254, 254, 254, 254, 256, 254, 254, 269, 472, 256, 258, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 255, 349, 349, 256, 473, 254, 268, 256, 254, 256,
+    474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505,
+    506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537,
+    538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569,
+    570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600, 601,
+    602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 0, 628, 0, 0, 0, 0,
+    629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660,
+    661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692,
+    693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 0, 0, 0, 0, 0, 0,
+    719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 0, 0, 741, 742, 743, 744, 745, 746, 0, 0,
+    747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778,
+    779, 780, 781, 782, 783, 784, 0, 0, 785, 786, 787, 788, 789, 790, 0, 0, 791, 792, 793, 794, 795, 796, 797, 798, 0, 799, 0, 800, 0, 801, 0, 802,
+    803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832, 0, 0,
+    833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863, 864,
+    865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884, 885, 0, 886, 887, 888, 889, 890, 891, 892, 0, 893, 0,
+    0, 894, 895, 896, 897, 0, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909, 910, 911, 0, 0, 912, 913, 914, 915, 916, 917, 0, 918, 919, 920,
+    921, 922, 923, 924, 925, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 0, 0, 937, 938, 939, 0, 940, 941, 942, 943, 944, 945, 946, 947, 0, 0,
+    948, 949, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 261, 261, 254, 254, 254, 254, 261, 261, 261, 254, 254, 0, 0, 0,
+    0, 254, 0, 0, 0, 261, 261, 254, 256, 254, 261, 261, 256, 256, 256, 256, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 950, 0, 0, 0, 951, 952, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 953, 954, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 955, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 956, 957, 958, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 959, 0, 0, 0, 0, 960, 0, 0, 961, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 962, 0, 963, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 964, 0, 0, 965, 0, 0, 966, 0, 967, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    968, 0, 969, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 970, 971, 972, 973, 974, 0, 0, 975, 976, 0, 0, 977, 978, 0, 0, 0, 0, 0, 0,
+    979, 980, 0, 0, 981, 982, 0, 0, 983, 984, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 985, 986, 987, 988, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    989, 990, 991, 992, 0, 0, 0, 0, 0, 0, 993, 994, 995, 996, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 997, 998, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 999, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 473, 349, 255, 348, 1000, 1000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1001, 0, 1002, 0, 1003, 0, 1004, 0, 1005, 0, 1006, 0, 1007, 0, 1008, 0, 1009, 0, 1010, 0,
+    1011, 0, 1012, 0, 0, 1013, 0, 1014, 0, 1015, 0, 0, 0, 0, 0, 0, 1016, 1017, 0, 1018, 1019, 0, 1020, 1021, 0, 1022, 1023, 0, 1024, 1025, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1026, 0, 0, 0, 0, 1027, 1027, 0, 0, 0, 1028, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1029, 0, 1030, 0, 1031, 0, 1032, 0, 1033, 0, 1034, 0, 1035, 0, 1036, 0, 1037, 0, 1038, 0,
+    1039, 0, 1040, 0, 0, 1041, 0, 1042, 0, 1043, 0, 0, 0, 0, 0, 0, 1044, 1045, 0, 1046, 1047, 0, 1048, 1049, 0, 1050, 1051, 0, 1052, 1053, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1054, 0, 0, 1055, 1056, 1057, 1058, 0, 0, 0, 1059, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 0, 0, 0, 0, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 0, 254, 254, 256, 0, 0, 254, 254, 0, 0, 0, 0, 0, 254, 254,
+    0, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060,
+    1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060,
+    1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060,
+    1060, 1060, 1060, 1060, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091,
+    1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123,
+    1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1080, 1152, 1153, 1154,
+    1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186,
+    1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218,
+    1219, 1170, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1154, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1080,
+    1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1156, 1275, 1276, 1277, 1278,
+    1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310,
+    1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 0, 0, 1325, 0, 1326, 0, 0, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 0,
+    1337, 0, 1338, 0, 0, 1339, 1340, 0, 0, 0, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362,
+    1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1209, 1386, 1387, 1388, 1389, 1390, 1391, 1391, 1392,
+    1393, 1394, 1395, 1396, 1397, 1398, 1399, 1339, 1400, 1401, 1402, 1403, 1404, 1405, 0, 0, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1353, 1414, 1415, 1416, 1325, 1417, 1418, 1419,
+    1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1362, 1429, 1363, 1430, 1431, 1432, 1433, 1434, 1326, 1101, 1435, 1436, 1437, 1171, 1258, 1438, 1439, 1370, 1440, 1371, 1441, 1442, 1443,
+    1328, 1444, 1445, 1446, 1447, 1448, 1329, 1449, 1450, 1451, 1452, 1453, 1454, 1385, 1455, 1456, 1209, 1457, 1389, 1458, 1459, 1460, 1461, 1462, 1394, 1463, 1338, 1464, 1395, 1152, 1465, 1396,
+    1466, 1398, 1467, 1468, 1469, 1470, 1471, 1400, 1334, 1472, 1401, 1473, 1402, 1474, 1068, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1486, 1487, 1488,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 0, 1502, 1503, 1504, 1505, 1506, 0, 1507, 0,
+    1508, 1509, 0, 1510, 1511, 0, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    254, 254, 254, 254, 254, 254, 254, 256, 256, 256, 256, 256, 256, 256, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 254, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 261, 256, 0, 0, 0, 0, 388,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 254, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 256, 256, 254, 254, 254, 256, 254, 256, 256, 256, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 254, 256, 254, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1521, 0, 1522, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1523, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 387, 0, 0, 0, 0, 0,
+    254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 1524, 1525, 0, 0, 0, 388, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 397, 0, 398, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1526, 1527, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 254, 254, 254, 0, 0, 0, 254, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 388, 0, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 1528, 1529, 398, 1530, 0,
+    0, 0, 388, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1531, 1532, 0, 0, 0, 388,
+    397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 397, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 397, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 0, 1533, 0, 0, 0, 0, 388, 388, 0,
+    0, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 397, 0, 388, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 261, 261, 261, 261, 261, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1534, 1534, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 261, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1535, 1536,
+    1537, 1538, 1539, 1540, 1541, 439, 439, 261, 261, 261, 0, 0, 0, 1542, 439, 439, 439, 439, 439, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 256, 256, 256,
+    256, 256, 256, 0, 0, 254, 254, 254, 254, 254, 256, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1543, 1544, 1545, 1546, 1547,
+    1548, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    254, 254, 254, 254, 254, 254, 254, 0, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 0, 0, 254, 254, 254, 254, 254,
+    254, 254, 0, 254, 254, 0, 254, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 256, 256, 256, 256, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 254, 254, 254, 254, 254, 254, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1549, 1550, 1551, 1552, 1553, 1347, 1554, 1555, 1556, 1557, 1348, 1558, 1559, 1560, 1349, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1407, 1573, 1574, 1575, 1576,
+    1577, 1578, 1579, 1580, 1581, 1412, 1350, 1351, 1413, 1582, 1583, 1158, 1584, 1352, 1585, 1586, 1587, 1588, 1588, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600,
+    1601, 1602, 1603, 1604, 1605, 1606, 1606, 1415, 1607, 1608, 1609, 1610, 1354, 1611, 1612, 1613, 1311, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628,
+    1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1639, 1640, 1641, 1642, 1154, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1359, 1651, 1652, 1653, 1654, 1655, 1656, 1657,
+    1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1100, 1672, 1673, 1674, 1674, 1675, 1676, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686,
+    1687, 1688, 1689, 1360, 1690, 1691, 1692, 1693, 1427, 1693, 1694, 1362, 1695, 1696, 1697, 1698, 1363, 1073, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712,
+    1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1364, 1721, 1722, 1723, 1724, 1725, 1726, 1366, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1101, 1435, 1735, 1736, 1737, 1738, 1739, 1740,
+    1741, 1742, 1367, 1743, 1744, 1745, 1746, 1478, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1171, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769,
+    1770, 1368, 1258, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1439, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1440, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797,
+    1798, 1442, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1809, 1810, 1811, 1444, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1157, 1819, 1820, 1821, 1822, 1823, 1824, 1825,
+    1450, 1826, 1827, 1828, 1829, 1830, 1831, 1831, 1451, 1480, 1832, 1833, 1834, 1835, 1836, 1119, 1453, 1837, 1838, 1379, 1839, 1840, 1333, 1841, 1842, 1383, 1843, 1844, 1845, 1846, 1846, 1847,
+    1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1389, 1874, 1875, 1876, 1877, 1878,
+    1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1675, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1175, 1902, 1903, 1904, 1905, 1906, 1907, 1392,
+    1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1114, 1928, 1929, 1930, 1931, 1932, 1933, 1460, 1934, 1935, 1936, 1937,
+    1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1465, 1466, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1467,
+    1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1473, 1473,
+    1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 1474, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const struct unicode_norm_record unicode_norm_records[2026] = {
+    {0, 120, 0}, {0, 89, 1}, {0, 89, 4}, {0, 89, 7}, {0, 89, 10}, {0, 89, 13}, {0, 89, 16}, {0, 89, 19},
+    {0, 89, 22}, {0, 89, 25}, {0, 89, 28}, {0, 89, 31}, {0, 89, 34}, {0, 89, 37}, {0, 89, 40}, {0, 89, 43},
+    {0, 89, 46}, {0, 89, 49}, {0, 89, 52}, {0, 89, 55}, {0, 89, 58}, {0, 89, 61}, {0, 89, 64}, {0, 89, 67},
+    {0, 89, 70}, {0, 89, 73}, {0, 89, 76}, {0, 89, 79}, {0, 89, 82}, {0, 89, 85}, {0, 89, 88}, {0, 89, 91},
+    {0, 89, 94}, {0, 89, 97}, {0, 89, 100}, {0, 89, 103}, {0, 89, 106}, {0, 89, 109}, {0, 89, 112}, {0, 89, 115},
+    {0, 89, 118}, {0, 89, 121}, {0, 89, 124}, {0, 89, 127}, {0, 89, 130}, {0, 89, 133}, {0, 89, 136}, {0, 89, 139},
+    {0, 89, 142}, {0, 89, 145}, {0, 89, 148}, {0, 89, 151}, {0, 89, 154}, {0, 89, 157}, {0, 89, 160}, {0, 89, 163},
+    {0, 89, 166}, {0, 89, 169}, {0, 89, 172}, {0, 89, 175}, {0, 89, 178}, {0, 89, 181}, {0, 89, 184}, {0, 89, 187},
+    {0, 89, 190}, {0, 89, 193}, {0, 89, 196}, {0, 89, 199}, {0, 89, 202}, {0, 89, 205}, {0, 89, 208}, {0, 89, 211},
+    {0, 89, 214}, {0, 89, 217}, {0, 89, 220}, {0, 89, 223}, {0, 89, 226}, {0, 89, 229}, {0, 89, 232}, {0, 89, 235},
+    {0, 89, 238}, {0, 89, 241}, {0, 89, 244}, {0, 89, 247}, {0, 89, 250}, {0, 89, 253}, {0, 89, 256}, {0, 89, 259},
+    {0, 89, 262}, {0, 89, 265}, {0, 89, 268}, {0, 89, 271}, {0, 89, 274}, {0, 89, 277}, {0, 89, 280}, {0, 89, 283},
+    {0, 89, 286}, {0, 89, 289}, {0, 89, 292}, {0, 89, 295}, {0, 89, 298}, {0, 89, 301}, {0, 89, 304}, {0, 89, 307},
+    {0, 89, 310}, {0, 89, 313}, {0, 89, 316}, {0, 89, 319}, {0, 89, 322}, {0, 89, 325}, {0, 89, 328}, {0, 89, 331},
+    {0, 89, 334}, {0, 89, 337}, {0, 89, 340}, {0, 89, 343}, {0, 89, 346}, {0, 89, 349}, {0, 89, 352}, {0, 89, 355},
+    {0, 89, 358}, {0, 89, 361}, {0, 89, 364}, {0, 89, 367}, {0, 89, 370}, {0, 89, 373}, {0, 89, 376}, {0, 89, 379},
+    {0, 89, 382}, {0, 89, 385}, {0, 89, 388}, {0, 89, 391}, {0, 89, 394}, {0, 89, 397}, {0, 89, 400}, {0, 89, 403},
+    {0, 89, 406}, {0, 89, 409}, {0, 89, 412}, {0, 89, 415}, {0, 89, 418}, {0, 89, 421}, {0, 89, 424}, {0, 89, 427},
+    {0, 89, 430}, {0, 89, 433}, {0, 89, 436}, {0, 89, 439}, {0, 89, 442}, {0, 89, 445}, {0, 89, 448}, {0, 89, 451},
+    {0, 89, 454}, {0, 89, 457}, {0, 89, 460}, {0, 89, 463}, {0, 89, 466}, {0, 89, 469}, {0, 89, 472}, {0, 89, 475},
+    {0, 89, 478}, {0, 89, 481}, {0, 89, 484}, {0, 89, 487}, {0, 89, 490}, {0, 89, 493}, {0, 89, 496}, {0, 89, 499},
+    {0, 89, 502}, {0, 89, 505}, {0, 89, 508}, {0, 89, 511}, {0, 89, 514}, {0, 89, 517}, {0, 89, 520}, {0, 89, 524},
+    {0, 89, 528}, {0, 89, 532}, {0, 89, 536}, {0, 89, 540}, {0, 89, 544}, {0, 89, 548}, {0, 89, 552}, {0, 89, 556},
+    {0, 89, 560}, {0, 89, 564}, {0, 89, 568}, {0, 89, 571}, {0, 89, 574}, {0, 89, 577}, {0, 89, 580}, {0, 89, 583},
+    {0, 89, 586}, {0, 89, 589}, {0, 89, 592}, {0, 89, 596}, {0, 89, 600}, {0, 89, 603}, {0, 89, 606}, {0, 89, 609},
+    {0, 89, 612}, {0, 89, 615}, {0, 89, 618}, {0, 89, 621}, {0, 89, 625}, {0, 89, 629}, {0, 89, 632}, {0, 89, 635},
+    {0, 89, 638}, {0, 89, 641}, {0, 89, 644}, {0, 89, 647}, {0, 89, 650}, {0, 89, 653}, {0, 89, 656}, {0, 89, 659},
+    {0, 89, 662}, {0, 89, 665}, {0, 89, 668}, {0, 89, 671}, {0, 89, 674}, {0, 89, 677}, {0, 89, 680}, {0, 89, 683},
+    {0, 89, 686}, {0, 89, 689}, {0, 89, 692}, {0, 89, 695}, {0, 89, 698}, {0, 89, 701}, {0, 89, 704}, {0, 89, 707},
+    {0, 89, 710}, {0, 89, 713}, {0, 89, 716}, {0, 89, 719}, {0, 89, 722}, {0, 89, 725}, {0, 89, 728}, {0, 89, 731},
+    {0, 89, 734}, {0, 89, 737}, {0, 89, 740}, {0, 89, 743}, {0, 89, 747}, {0, 89, 751}, {0, 89, 755}, {0, 89, 759},
+    {0, 89, 762}, {0, 89, 765}, {0, 89, 769}, {0, 89, 773}, {0, 89, 776}, {230, 4, 0}, {230, 0, 0}, {232, 0, 0},
+    {220, 0, 0}, {216, 4, 0}, {202, 0, 0}, {220, 4, 0}, {202, 4, 0}, {1, 0, 0}, {1, 4, 0}, {230, 3, 779},
+    {230, 3, 781}, {230, 3, 783}, {230, 3, 785}, {240, 4, 0}, {233, 0, 0}, {234, 0, 0}, {0, 27, 788}, {0, 27, 790},
+    {0, 89, 792}, {0, 89, 795}, {0, 27, 798}, {0, 89, 800}, {0, 89, 803}, {0, 89, 806}, {0, 89, 809}, {0, 89, 812},
+    {0, 89, 815}, {0, 89, 818}, {0, 89, 822}, {0, 89, 825}, {0, 89, 828}, {0, 89, 831}, {0, 89, 834}, {0, 89, 837},
+    {0, 89, 840}, {0, 89, 844}, {0, 89, 847}, {0, 89, 850}, {0, 89, 853}, {0, 89, 856}, {0, 89, 859}, {0, 89, 862},
+    {0, 89, 865}, {0, 89, 868}, {0, 89, 871}, {0, 89, 874}, {0, 89, 877}, {0, 89, 880}, {0, 89, 883}, {0, 89, 886},
+    {0, 89, 889}, {0, 89, 892}, {0, 89, 895}, {0, 89, 898}, {0, 89, 901}, {0, 89, 904}, {0, 89, 907}, {0, 89, 910},
+    {0, 89, 913}, {0, 89, 916}, {0, 89, 919}, {0, 89, 922}, {0, 89, 925}, {0, 89, 928}, {0, 89, 931}, {0, 89, 934},
+    {0, 89, 937}, {0, 89, 940}, {0, 89, 943}, {0, 89, 946}, {0, 89, 949}, {0, 89, 952}, {0, 89, 955}, {0, 89, 958},
+    {0, 89, 961}, {0, 89, 964}, {0, 89, 967}, {0, 89, 970}, {0, 89, 973}, {0, 89, 976}, {0, 89, 979}, {0, 89, 982},
+    {0, 89, 985}, {0, 89, 988}, {0, 89, 991}, {0, 89, 994}, {0, 89, 997}, {0, 89, 1000}, {0, 89, 1003}, {0, 89, 1006},
+    {0, 89, 1009}, {0, 89, 1012}, {0, 89, 1015}, {0, 89, 1018}, {222, 0, 0}, {228, 0, 0}, {10, 0, 0}, {11, 0, 0},
+    {12, 0, 0}, {13, 0, 0}, {14, 0, 0}, {15, 0, 0}, {16, 0, 0}, {17, 0, 0}, {18, 0, 0}, {19, 0, 0},
+    {20, 0, 0}, {21, 0, 0}, {22, 0, 0}, {23, 0, 0}, {24, 0, 0}, {25, 0, 0}, {30, 0, 0}, {31, 0, 0},
+    {32, 0, 0}, {0, 89, 1021}, {0, 89, 1024}, {0, 89, 1027}, {0, 89, 1030}, {0, 89, 1033}, {27, 0, 0}, {28, 0, 0},
+    {29, 0, 0}, {33, 0, 0}, {34, 0, 0}, {35, 0, 0}, {0, 89, 1036}, {0, 89, 1039}, {0, 89, 1042}, {36, 0, 0},
+    {0, 89, 1045}, {0, 89, 1048}, {0, 89, 1051}, {7, 4, 0}, {9, 0, 0}, {0, 27, 1054}, {0, 27, 1057}, {0, 27, 1060},
+    {0, 27, 1063}, {0, 27, 1066}, {0, 27, 1069}, {0, 27, 1072}, {0, 27, 1075}, {7, 0, 0}, {0, 44, 0}, {0, 89, 1078},
+    {0, 89, 1081}, {0, 27, 1084}, {0, 27, 1087}, {0, 27, 1090}, {0, 27, 1093}, {0, 27, 1096}, {0, 27, 1099}, {0, 27, 1102},
+    {0, 27, 1105}, {0, 27, 1108}, {0, 89, 1111}, {0, 89, 1114}, {0, 89, 1117}, {0, 27, 1120}, {0, 27, 1123}, {0, 89, 1126},
+    {0, 89, 1129}, {0, 89, 1132}, {0, 89, 1135}, {0, 89, 1138}, {84, 0, 0}, {91, 4, 0}, {0, 89, 1141}, {0, 89, 1144},
+    {0, 89, 1147}, {0, 89, 1150}, {0, 89, 1153}, {0, 89, 1157}, {0, 89, 1160}, {0, 89, 1163}, {9, 4, 0}, {0, 89, 1166},
+    {0, 89, 1169}, {0, 89, 1172}, {0, 89, 1176}, {103, 0, 0}, {107, 0, 0}, {118, 0, 0}, {122, 0, 0}, {216, 0, 0},
+    {0, 27, 1179}, {0, 27, 1182}, {0, 27, 1185}, {0, 27, 1188}, {0, 27, 1191}, {0, 27, 1194}, {129, 0, 0}, {130, 0, 0},
+    {0, 3, 1197}, {132, 0, 0}, {0, 3, 1200}, {0, 27, 1203}, {0, 27, 1206}, {0, 3, 1209}, {0, 27, 1212}, {0, 27, 1215},
+    {0, 27, 1218}, {0, 27, 1221}, {0, 27, 1224}, {0, 27, 1227}, {0, 89, 1230}, {0, 89, 1233}, {0, 89, 1236}, {0, 89, 1239},
+    {0, 89, 1242}, {0, 89, 1245}, {0, 89, 1248}, {0, 89, 1251}, {0, 89, 1254}, {0, 89, 1257}, {0, 89, 1260}, {0, 89, 1263},
+    {214, 0, 0}, {218, 0, 0}, {0, 89, 1266}, {0, 89, 1269}, {0, 89, 1272}, {0, 89, 1275}, {0, 89, 1278}, {0, 89, 1281},
+    {0, 89, 1284}, {0, 89, 1287}, {0, 89, 1290}, {0, 89, 1294}, {0, 89, 1298}, {0, 89, 1301}, {0, 89, 1304}, {0, 89, 1307},
+    {0, 89, 1310}, {0, 89, 1313}, {0, 89, 1316}, {0, 89, 1319}, {0, 89, 1322}, {0, 89, 1325}, {0, 89, 1328}, {0, 89, 1332},
+    {0, 89, 1336}, {0, 89, 1340}, {0, 89, 1344}, {0, 89, 1347}, {0, 89, 1350}, {0, 89, 1353}, {0, 89, 1356}, {0, 89, 1360},
+    {0, 89, 1364}, {0, 89, 1367}, {0, 89, 1370}, {0, 89, 1373}, {0, 89, 1376}, {0, 89, 1379}, {0, 89, 1382}, {0, 89, 1385},
+    {0, 89, 1388}, {0, 89, 1391}, {0, 89, 1394}, {0, 89, 1397}, {0, 89, 1400}, {0, 89, 1403}, {0, 89, 1406}, {0, 89, 1409},
+    {0, 89, 1412}, {0, 89, 1416}, {0, 89, 1420}, {0, 89, 1423}, {0, 89, 1426}, {0, 89, 1429}, {0, 89, 1432}, {0, 89, 1435},
+    {0, 89, 1438}, {0, 89, 1441}, {0, 89, 1444}, {0, 89, 1448}, {0, 89, 1452}, {0, 89, 1455}, {0, 89, 1458}, {0, 89, 1461},
+    {0, 89, 1464}, {0, 89, 1467}, {0, 89, 1470}, {0, 89, 1473}, {0, 89, 1476}, {0, 89, 1479}, {0, 89, 1482}, {0, 89, 1485},
+    {0, 89, 1488}, {0, 89, 1491}, {0, 89, 1494}, {0, 89, 1497}, {0, 89, 1500}, {0, 89, 1503}, {0, 89, 1506}, {0, 89, 1510},
+    {0, 89, 1514}, {0, 89, 1518}, {0, 89, 1522}, {0, 89, 1526}, {0, 89, 1530}, {0, 89, 1534}, {0, 89, 1538}, {0, 89, 1541},
+    {0, 89, 1544}, {0, 89, 1547}, {0, 89, 1550}, {0, 89, 1553}, {0, 89, 1556}, {0, 89, 1559}, {0, 89, 1562}, {0, 89, 1566},
+    {0, 89, 1570}, {0, 89, 1573}, {0, 89, 1576}, {0, 89, 1579}, {0, 89, 1582}, {0, 89, 1585}, {0, 89, 1588}, {0, 89, 1592},
+    {0, 89, 1596}, {0, 89, 1600}, {0, 89, 1604}, {0, 89, 1608}, {0, 89, 1612}, {0, 89, 1615}, {0, 89, 1618}, {0, 89, 1621},
+    {0, 89, 1624}, {0, 89, 1627}, {0, 89, 1630}, {0, 89, 1633}, {0, 89, 1636}, {0, 89, 1639}, {0, 89, 1642}, {0, 89, 1645},
+    {0, 89, 1648}, {0, 89, 1651}, {0, 89, 1654}, {0, 89, 1658}, {0, 89, 1662}, {0, 89, 1666}, {0, 89, 1670}, {0, 89, 1673},
+    {0, 89, 1676}, {0, 89, 1679}, {0, 89, 1682}, {0, 89, 1685}, {0, 89, 1688}, {0, 89, 1691}, {0, 89, 1694}, {0, 89, 1697},
+    {0, 89, 1700}, {0, 89, 1703}, {0, 89, 1706}, {0, 89, 1709}, {0, 89, 1712}, {0, 89, 1715}, {0, 89, 1718}, {0, 89, 1721},
+    {0, 89, 1724}, {0, 89, 1727}, {0, 89, 1730}, {0, 89, 1733}, {0, 89, 1736}, {0, 89, 1739}, {0, 89, 1742}, {0, 89, 1745},
+    {0, 89, 1748}, {0, 89, 1751}, {0, 89, 1754}, {0, 89, 1757}, {0, 89, 1760}, {0, 89, 1763}, {0, 89, 1766}, {0, 89, 1769},
+    {0, 89, 1772}, {0, 89, 1775}, {0, 89, 1779}, {0, 89, 1783}, {0, 89, 1787}, {0, 89, 1791}, {0, 89, 1795}, {0, 89, 1799},
+    {0, 89, 1803}, {0, 89, 1807}, {0, 89, 1811}, {0, 89, 1815}, {0, 89, 1819}, {0, 89, 1823}, {0, 89, 1827}, {0, 89, 1831},
+    {0, 89, 1835}, {0, 89, 1839}, {0, 89, 1843}, {0, 89, 1847}, {0, 89, 1851}, {0, 89, 1855}, {0, 89, 1858}, {0, 89, 1861},
+    {0, 89, 1864}, {0, 89, 1867}, {0, 89, 1870}, {0, 89, 1873}, {0, 89, 1877}, {0, 89, 1881}, {0, 89, 1885}, {0, 89, 1889},
+    {0, 89, 1893}, {0, 89, 1897}, {0, 89, 1901}, {0, 89, 1905}, {0, 89, 1909}, {0, 89, 1913}, {0, 89, 1916}, {0, 89, 1919},
+    {0, 89, 1922}, {0, 89, 1925}, {0, 89, 1928}, {0, 89, 1931}, {0, 89, 1934}, {0, 89, 1937}, {0, 89, 1941}, {0, 89, 1945},
+    {0, 89, 1949}, {0, 89, 1953}, {0, 89, 1957}, {0, 89, 1961}, {0, 89, 1965}, {0, 89, 1969}, {0, 89, 1973}, {0, 89, 1977},
+    {0, 89, 1981}, {0, 89, 1985}, {0, 89, 1989}, {0, 89, 1993}, {0, 89, 1997}, {0, 89, 2001}, {0, 89, 2005}, {0, 89, 2009},
+    {0, 89, 2013}, {0, 89, 2017}, {0, 89, 2020}, {0, 89, 2023}, {0, 89, 2026}, {0, 89, 2029}, {0, 89, 2033}, {0, 89, 2037},
+    {0, 89, 2041}, {0, 89, 2045}, {0, 89, 2049}, {0, 89, 2053}, {0, 89, 2057}, {0, 89, 2061}, {0, 89, 2065}, {0, 89, 2069},
+    {0, 89, 2072}, {0, 89, 2075}, {0, 89, 2078}, {0, 89, 2081}, {0, 89, 2084}, {0, 89, 2087}, {0, 89, 2090}, {0, 89, 2093},
+    {0, 89, 2096}, {0, 89, 2099}, {0, 89, 2103}, {0, 89, 2107}, {0, 89, 2111}, {0, 89, 2115}, {0, 89, 2119}, {0, 89, 2123},
+    {0, 89, 2126}, {0, 89, 2129}, {0, 89, 2133}, {0, 89, 2137}, {0, 89, 2141}, {0, 89, 2145}, {0, 89, 2149}, {0, 89, 2153},
+    {0, 89, 2156}, {0, 89, 2159}, {0, 89, 2163}, {0, 89, 2167}, {0, 89, 2171}, {0, 89, 2175}, {0, 89, 2178}, {0, 89, 2181},
+    {0, 89, 2185}, {0, 89, 2189}, {0, 89, 2193}, {0, 89, 2197}, {0, 89, 2200}, {0, 89, 2203}, {0, 89, 2207}, {0, 89, 2211},
+    {0, 89, 2215}, {0, 89, 2219}, {0, 89, 2223}, {0, 89, 2227}, {0, 89, 2230}, {0, 89, 2233}, {0, 89, 2237}, {0, 89, 2241},
+    {0, 89, 2245}, {0, 89, 2249}, {0, 89, 2253}, {0, 89, 2257}, {0, 89, 2260}, {0, 89, 2263}, {0, 89, 2267}, {0, 89, 2271},
+    {0, 89, 2275}, {0, 89, 2279}, {0, 89, 2283}, {0, 89, 2287}, {0, 89, 2290}, {0, 89, 2293}, {0, 89, 2297}, {0, 89, 2301},
+    {0, 89, 2305}, {0, 89, 2309}, {0, 89, 2313}, {0, 89, 2317}, {0, 89, 2320}, {0, 89, 2323}, {0, 89, 2327}, {0, 89, 2331},
+    {0, 89, 2335}, {0, 89, 2339}, {0, 89, 2342}, {0, 89, 2345}, {0, 89, 2349}, {0, 89, 2353}, {0, 89, 2357}, {0, 89, 2361},
+    {0, 89, 2364}, {0, 89, 2367}, {0, 89, 2371}, {0, 89, 2375}, {0, 89, 2379}, {0, 89, 2383}, {0, 89, 2387}, {0, 89, 2391},
+    {0, 89, 2394}, {0, 89, 2398}, {0, 89, 2402}, {0, 89, 2406}, {0, 89, 2409}, {0, 89, 2412}, {0, 89, 2416}, {0, 89, 2420},
+    {0, 89, 2424}, {0, 89, 2428}, {0, 89, 2432}, {0, 89, 2436}, {0, 89, 2439}, {0, 89, 2442}, {0, 89, 2446}, {0, 89, 2450},
+    {0, 89, 2454}, {0, 89, 2458}, {0, 89, 2462}, {0, 89, 2466}, {0, 27, 828}, {0, 89, 2469}, {0, 27, 831}, {0, 89, 2472},
+    {0, 27, 834}, {0, 89, 2475}, {0, 27, 837}, {0, 89, 2478}, {0, 27, 850}, {0, 89, 2481}, {0, 27, 853}, {0, 89, 2484},
+    {0, 27, 856}, {0, 89, 2487}, {0, 89, 2491}, {0, 89, 2495}, {0, 89, 2500}, {0, 89, 2505}, {0, 89, 2510}, {0, 89, 2515},
+    {0, 89, 2520}, {0, 89, 2525}, {0, 89, 2529}, {0, 89, 2533}, {0, 89, 2538}, {0, 89, 2543}, {0, 89, 2548}, {0, 89, 2553},
+    {0, 89, 2558}, {0, 89, 2563}, {0, 89, 2567}, {0, 89, 2571}, {0, 89, 2576}, {0, 89, 2581}, {0, 89, 2586}, {0, 89, 2591},
+    {0, 89, 2596}, {0, 89, 2601}, {0, 89, 2605}, {0, 89, 2609}, {0, 89, 2614}, {0, 89, 2619}, {0, 89, 2624}, {0, 89, 2629},
+    {0, 89, 2634}, {0, 89, 2639}, {0, 89, 2643}, {0, 89, 2647}, {0, 89, 2652}, {0, 89, 2657}, {0, 89, 2662}, {0, 89, 2667},
+    {0, 89, 2672}, {0, 89, 2677}, {0, 89, 2681}, {0, 89, 2685}, {0, 89, 2690}, {0, 89, 2695}, {0, 89, 2700}, {0, 89, 2705},
+    {0, 89, 2710}, {0, 89, 2715}, {0, 89, 2718}, {0, 89, 2721}, {0, 89, 2725}, {0, 89, 2728}, {0, 89, 2732}, {0, 89, 2735},
+    {0, 89, 2739}, {0, 89, 2742}, {0, 89, 2745}, {0, 27, 795}, {0, 89, 2748}, {0, 27, 2751}, {0, 89, 2753}, {0, 89, 2756},
+    {0, 89, 2760}, {0, 89, 2763}, {0, 89, 2767}, {0, 89, 2770}, {0, 89, 2774}, {0, 27, 800}, {0, 89, 2777}, {0, 27, 803},
+    {0, 89, 2780}, {0, 89, 2783}, {0, 89, 2786}, {0, 89, 2789}, {0, 89, 2792}, {0, 89, 2795}, {0, 89, 2798}, {0, 27, 818},
+    {0, 89, 2802}, {0, 89, 2805}, {0, 89, 2809}, {0, 89, 2812}, {0, 89, 2815}, {0, 27, 806}, {0, 89, 2818}, {0, 89, 2821},
+    {0, 89, 2824}, {0, 89, 2827}, {0, 89, 2830}, {0, 89, 2833}, {0, 27, 840}, {0, 89, 2837}, {0, 89, 2840}, {0, 89, 2843},
+    {0, 89, 2846}, {0, 89, 2850}, {0, 89, 2853}, {0, 89, 2856}, {0, 27, 812}, {0, 89, 2859}, {0, 89, 2862}, {0, 27, 792},
+    {0, 27, 2865}, {0, 89, 2867}, {0, 89, 2871}, {0, 89, 2874}, {0, 89, 2878}, {0, 89, 2881}, {0, 89, 2885}, {0, 27, 809},
+    {0, 89, 2888}, {0, 27, 815}, {0, 89, 2891}, {0, 27, 2894}, {0, 27, 2896}, {0, 27, 2898}, {0, 27, 2900}, {0, 27, 2902},
+    {0, 27, 16}, {0, 89, 2904}, {0, 89, 2907}, {0, 89, 2910}, {0, 89, 2913}, {0, 89, 2916}, {0, 89, 2919}, {0, 89, 2922},
+    {0, 89, 2925}, {0, 89, 2928}, {0, 89, 2931}, {0, 89, 2934}, {0, 89, 2937}, {0, 89, 2940}, {0, 89, 2943}, {0, 89, 2946},
+    {0, 89, 2949}, {0, 89, 2952}, {0, 89, 2955}, {0, 89, 2958}, {0, 89, 2961}, {0, 89, 2964}, {0, 89, 2967}, {0, 89, 2970},
+    {0, 89, 2973}, {0, 89, 2976}, {0, 89, 2979}, {0, 89, 2982}, {0, 89, 2985}, {0, 89, 2988}, {0, 89, 2991}, {0, 89, 2994},
+    {0, 89, 2997}, {0, 89, 3000}, {0, 89, 3003}, {0, 89, 3006}, {0, 89, 3009}, {0, 89, 3012}, {0, 89, 3015}, {0, 89, 3018},
+    {0, 89, 3021}, {0, 89, 3024}, {0, 89, 3027}, {0, 89, 3030}, {0, 89, 3033}, {0, 27, 3036}, {0, 27, 3038}, {0, 27, 3040},
+    {224, 0, 0}, {0, 89, 3043}, {0, 89, 3046}, {0, 89, 3049}, {0, 89, 3052}, {0, 89, 3055}, {0, 89, 3058}, {0, 89, 3061},
+    {0, 89, 3064}, {0, 89, 3067}, {0, 89, 3070}, {0, 89, 3073}, {0, 89, 3076}, {0, 89, 3079}, {0, 89, 3082}, {0, 89, 3085},
+    {0, 89, 3088}, {0, 89, 3091}, {0, 89, 3094}, {0, 89, 3097}, {0, 89, 3100}, {0, 89, 3103}, {0, 89, 3106}, {0, 89, 3109},
+    {0, 89, 3112}, {0, 89, 3115}, {0, 89, 3118}, {8, 4, 0}, {0, 89, 3121}, {0, 89, 3124}, {0, 89, 3127}, {0, 89, 3130},
+    {0, 89, 3133}, {0, 89, 3136}, {0, 89, 3139}, {0, 89, 3142}, {0, 89, 3145}, {0, 89, 3148}, {0, 89, 3151}, {0, 89, 3154},
+    {0, 89, 3157}, {0, 89, 3160}, {0, 89, 3163}, {0, 89, 3166}, {0, 89, 3169}, {0, 89, 3172}, {0, 89, 3175}, {0, 89, 3178},
+    {0, 89, 3181}, {0, 89, 3184}, {0, 89, 3187}, {0, 89, 3190}, {0, 89, 3193}, {0, 89, 3196}, {0, 89, 3199}, {0, 89, 3202},
+    {0, 89, 3205}, {0, 89, 3208}, {0, 89, 3211}, {0, 89, 3214}, {0, 89, 0}, {0, 27, 3217}, {0, 27, 3219}, {0, 27, 3221},
+    {0, 27, 3223}, {0, 27, 3225}, {0, 27, 3227}, {0, 27, 3229}, {0, 27, 3231}, {0, 27, 3233}, {0, 27, 3235}, {0, 27, 3237},
+    {0, 27, 3239}, {0, 27, 3241}, {0, 27, 3243}, {0, 27, 3245}, {0, 27, 3247}, {0, 27, 3249}, {0, 27, 3251}, {0, 27, 3253},
+    {0, 27, 3255}, {0, 27, 3257}, {0, 27, 3259}, {0, 27, 3261}, {0, 27, 3263}, {0, 27, 3265}, {0, 27, 3267}, {0, 27, 3269},
+    {0, 27, 3271}, {0, 27, 3273}, {0, 27, 3275}, {0, 27, 3277}, {0, 27, 3279}, {0, 27, 3281}, {0, 27, 3283}, {0, 27, 3285},
+    {0, 27, 3287}, {0, 27, 3289}, {0, 27, 3291}, {0, 27, 3293}, {0, 27, 3295}, {0, 27, 3297}, {0, 27, 3299}, {0, 27, 3301},
+    {0, 27, 3303}, {0, 27, 3305}, {0, 27, 3307}, {0, 27, 3309}, {0, 27, 3311}, {0, 27, 3313}, {0, 27, 3315}, {0, 27, 3317},
+    {0, 27, 3319}, {0, 27, 3321}, {0, 27, 3323}, {0, 27, 3325}, {0, 27, 3327}, {0, 27, 3329}, {0, 27, 3331}, {0, 27, 3333},
+    {0, 27, 3335}, {0, 27, 3337}, {0, 27, 3339}, {0, 27, 3341}, {0, 27, 3343}, {0, 27, 3345}, {0, 27, 3347}, {0, 27, 3349},
+    {0, 27, 3351}, {0, 27, 3353}, {0, 27, 3355}, {0, 27, 3357}, {0, 27, 3359}, {0, 27, 3361}, {0, 27, 3363}, {0, 27, 3365},
+    {0, 27, 3367}, {0, 27, 3369}, {0, 27, 3371}, {0, 27, 3373}, {0, 27, 3375}, {0, 27, 3377}, {0, 27, 3379}, {0, 27, 3381},
+    {0, 27, 3383}, {0, 27, 3385}, {0, 27, 3387}, {0, 27, 3389}, {0, 27, 3391}, {0, 27, 3393}, {0, 27, 3395}, {0, 27, 3397},
+    {0, 27, 3399}, {0, 27, 3401}, {0, 27, 3403}, {0, 27, 3405}, {0, 27, 3407}, {0, 27, 3409}, {0, 27, 3411}, {0, 27, 3413},
+    {0, 27, 3415}, {0, 27, 3417}, {0, 27, 3419}, {0, 27, 3421}, {0, 27, 3423}, {0, 27, 3425}, {0, 27, 3427}, {0, 27, 3429},
+    {0, 27, 3431}, {0, 27, 3433}, {0, 27, 3435}, {0, 27, 3437}, {0, 27, 3439}, {0, 27, 3441}, {0, 27, 3443}, {0, 27, 3445},
+    {0, 27, 3447}, {0, 27, 3449}, {0, 27, 3451}, {0, 27, 3453}, {0, 27, 3455}, {0, 27, 3457}, {0, 27, 3459}, {0, 27, 3461},
+    {0, 27, 3463}, {0, 27, 3465}, {0, 27, 3467}, {0, 27, 3469}, {0, 27, 3471}, {0, 27, 3473}, {0, 27, 3475}, {0, 27, 3477},
+    {0, 27, 3479}, {0, 27, 3481}, {0, 27, 3483}, {0, 27, 3485}, {0, 27, 3487}, {0, 27, 3489}, {0, 27, 3491}, {0, 27, 3493},
+    {0, 27, 3495}, {0, 27, 3497}, {0, 27, 3499}, {0, 27, 3501}, {0, 27, 3503}, {0, 27, 3505}, {0, 27, 3507}, {0, 27, 3509},
+    {0, 27, 3511}, {0, 27, 3513}, {0, 27, 3515}, {0, 27, 3517}, {0, 27, 3519}, {0, 27, 3521}, {0, 27, 3523}, {0, 27, 3525},
+    {0, 27, 3527}, {0, 27, 3529}, {0, 27, 3531}, {0, 27, 3533}, {0, 27, 3535}, {0, 27, 3537}, {0, 27, 3539}, {0, 27, 3541},
+    {0, 27, 3543}, {0, 27, 3545}, {0, 27, 3547}, {0, 27, 3549}, {0, 27, 3551}, {0, 27, 3553}, {0, 27, 3555}, {0, 27, 3557},
+    {0, 27, 3559}, {0, 27, 3561}, {0, 27, 3563}, {0, 27, 3565}, {0, 27, 3567}, {0, 27, 3569}, {0, 27, 3571}, {0, 27, 3573},
+    {0, 27, 3575}, {0, 27, 3577}, {0, 27, 3579}, {0, 27, 3581}, {0, 27, 3583}, {0, 27, 3585}, {0, 27, 3587}, {0, 27, 3589},
+    {0, 27, 3591}, {0, 27, 3593}, {0, 27, 3595}, {0, 27, 3597}, {0, 27, 3599}, {0, 27, 3601}, {0, 27, 3603}, {0, 27, 3605},
+    {0, 27, 3607}, {0, 27, 3609}, {0, 27, 3611}, {0, 27, 3613}, {0, 27, 3615}, {0, 27, 3617}, {0, 27, 3619}, {0, 27, 3621},
+    {0, 27, 3623}, {0, 27, 3625}, {0, 27, 3627}, {0, 27, 3629}, {0, 27, 3631}, {0, 27, 3633}, {0, 27, 3635}, {0, 27, 3637},
+    {0, 27, 3639}, {0, 27, 3641}, {0, 27, 3643}, {0, 27, 3645}, {0, 27, 3647}, {0, 27, 3649}, {0, 27, 3651}, {0, 27, 3653},
+    {0, 27, 3655}, {0, 27, 3657}, {0, 27, 3659}, {0, 27, 3661}, {0, 27, 3663}, {0, 27, 3665}, {0, 27, 3667}, {0, 27, 3669},
+    {0, 27, 3671}, {0, 27, 3673}, {0, 27, 3675}, {0, 27, 3677}, {0, 27, 3679}, {0, 27, 3681}, {0, 27, 3683}, {0, 27, 3685},
+    {0, 27, 3687}, {0, 27, 3689}, {0, 27, 3691}, {0, 27, 3693}, {0, 27, 3695}, {0, 27, 3697}, {0, 27, 3699}, {0, 27, 3701},
+    {0, 27, 3703}, {0, 27, 3705}, {0, 27, 3707}, {0, 27, 3709}, {0, 27, 3711}, {0, 27, 3713}, {0, 27, 3715}, {0, 27, 3717},
+    {0, 27, 3719}, {0, 27, 3721}, {0, 27, 3723}, {0, 27, 3725}, {0, 27, 3727}, {0, 27, 3729}, {0, 27, 3731}, {0, 27, 3733},
+    {0, 27, 3735}, {0, 27, 3737}, {0, 27, 3739}, {0, 27, 3741}, {0, 27, 3743}, {0, 27, 3745}, {0, 27, 3747}, {0, 27, 3749},
+    {0, 27, 3751}, {0, 27, 3753}, {0, 27, 3755}, {0, 27, 3757}, {0, 27, 3759}, {0, 27, 3761}, {0, 27, 3763}, {0, 27, 3765},
+    {0, 27, 3767}, {0, 27, 3769}, {0, 27, 3771}, {0, 27, 3773}, {0, 27, 3775}, {0, 27, 3777}, {0, 27, 3779}, {0, 27, 3781},
+    {0, 27, 3783}, {0, 27, 3785}, {0, 27, 3787}, {0, 27, 3789}, {0, 27, 3791}, {0, 27, 3793}, {0, 27, 3795}, {0, 27, 3797},
+    {0, 27, 3799}, {0, 27, 3801}, {0, 27, 3803}, {0, 27, 3805}, {0, 27, 3807}, {0, 27, 3809}, {0, 27, 3811}, {0, 27, 3813},
+    {0, 27, 3815}, {0, 27, 3817}, {0, 27, 3819}, {0, 27, 3821}, {0, 27, 3823}, {0, 27, 3825}, {0, 27, 3827}, {0, 27, 3829},
+    {0, 27, 3831}, {0, 27, 3833}, {0, 27, 3835}, {0, 27, 3837}, {0, 27, 3839}, {0, 27, 3841}, {0, 27, 3843}, {0, 27, 3845},
+    {0, 27, 3847}, {0, 27, 3849}, {0, 27, 3851}, {0, 27, 3853}, {0, 27, 3855}, {0, 27, 3857}, {0, 27, 3859}, {0, 27, 3861},
+    {0, 27, 3863}, {0, 27, 3865}, {0, 27, 3867}, {0, 27, 3869}, {0, 27, 3871}, {0, 27, 3873}, {0, 27, 3875}, {0, 27, 3877},
+    {0, 27, 3879}, {0, 27, 3881}, {0, 27, 3883}, {0, 27, 3885}, {0, 27, 3887}, {0, 27, 3889}, {0, 27, 3891}, {0, 27, 3893},
+    {0, 27, 3895}, {0, 27, 3897}, {0, 27, 3899}, {0, 27, 3901}, {0, 27, 3903}, {0, 27, 3905}, {0, 27, 3907}, {0, 27, 3909},
+    {0, 27, 3911}, {0, 27, 3913}, {0, 27, 3915}, {0, 27, 3917}, {0, 27, 3919}, {0, 27, 3921}, {0, 27, 3923}, {0, 27, 3925},
+    {0, 27, 3927}, {0, 27, 3929}, {0, 27, 3931}, {0, 27, 3933}, {0, 27, 3935}, {0, 27, 3937}, {0, 27, 3939}, {0, 27, 3941},
+    {0, 27, 3943}, {0, 27, 3945}, {0, 27, 3947}, {0, 27, 3949}, {0, 27, 3951}, {0, 27, 3953}, {0, 27, 3955}, {0, 27, 3957},
+    {0, 27, 3959}, {0, 27, 3961}, {0, 27, 3963}, {0, 27, 3965}, {0, 27, 3967}, {0, 27, 3969}, {0, 27, 3971}, {0, 27, 3973},
+    {0, 27, 3975}, {0, 27, 3977}, {0, 27, 3979}, {0, 27, 3981}, {0, 27, 3983}, {0, 27, 3985}, {0, 27, 3987}, {0, 27, 3989},
+    {0, 27, 3991}, {0, 27, 3993}, {0, 27, 3995}, {0, 27, 3997}, {0, 27, 3999}, {0, 27, 4001}, {0, 27, 4003}, {0, 27, 4005},
+    {0, 27, 4007}, {0, 27, 4009}, {0, 27, 4011}, {0, 27, 4013}, {0, 27, 4015}, {0, 27, 4017}, {0, 27, 4019}, {0, 27, 4021},
+    {0, 27, 4023}, {0, 27, 4025}, {0, 27, 4027}, {0, 27, 4029}, {0, 27, 4031}, {0, 27, 4033}, {0, 27, 4035}, {0, 27, 4037},
+    {0, 27, 4039}, {0, 27, 4041}, {0, 27, 4043}, {0, 27, 4045}, {0, 27, 4047}, {0, 27, 4049}, {0, 27, 4051}, {0, 27, 4053},
+    {0, 27, 4055}, {0, 27, 4057}, {0, 27, 4059}, {0, 27, 4061}, {0, 27, 4063}, {0, 27, 4065}, {0, 27, 4067}, {26, 0, 0},
+    {0, 27, 4070}, {0, 27, 4073}, {0, 27, 4076}, {0, 27, 4079}, {0, 27, 4083}, {0, 27, 4087}, {0, 27, 4090}, {0, 27, 4093},
+    {0, 27, 4096}, {0, 27, 4099}, {0, 27, 4102}, {0, 27, 4105}, {0, 27, 4108}, {0, 27, 4111}, {0, 27, 4114}, {0, 27, 4117},
+    {0, 27, 4120}, {0, 27, 4123}, {0, 27, 4126}, {0, 27, 4129}, {0, 27, 4132}, {0, 27, 4135}, {0, 27, 4138}, {0, 27, 4141},
+    {0, 27, 4144}, {0, 27, 4147}, {0, 27, 4150}, {0, 27, 4153}, {0, 27, 4156}, {0, 27, 4159}, {0, 27, 4162}, {0, 27, 4165},
+    {0, 27, 4168}, {0, 89, 4171}, {0, 89, 4174}, {0, 89, 4177}, {0, 89, 4180}, {0, 89, 4183}, {0, 89, 4186}, {0, 89, 4189},
+    {0, 89, 4192}, {0, 89, 4195}, {0, 89, 4198}, {0, 89, 4201}, {0, 89, 4204}, {0, 89, 4207}, {6, 0, 0}, {0, 27, 4210},
+    {0, 27, 4213}, {0, 27, 4216}, {0, 27, 4220}, {0, 27, 4224}, {0, 27, 4228}, {0, 27, 4232}, {226, 0, 0}, {0, 27, 4236},
+    {0, 27, 4239}, {0, 27, 4242}, {0, 27, 4246}, {0, 27, 4250}, {0, 27, 4254}, {0, 27, 4258}, {0, 27, 4260}, {0, 27, 4262},
+    {0, 27, 4264}, {0, 27, 4266}, {0, 27, 4268}, {0, 27, 4270}, {0, 27, 4272}, {0, 27, 4274}, {0, 27, 4276}, {0, 27, 4278},
+    {0, 27, 4280}, {0, 27, 4282}, {0, 27, 4284}, {0, 27, 4286}, {0, 27, 4288}, {0, 27, 4290}, {0, 27, 4292}, {0, 27, 4294},
+    {0, 27, 4296}, {0, 27, 4298}, {0, 27, 4300}, {0, 27, 4302}, {0, 27, 4304}, {0, 27, 4306}, {0, 27, 4308}, {0, 27, 4310},
+    {0, 27, 4312}, {0, 27, 4314}, {0, 27, 4316}, {0, 27, 4318}, {0, 27, 4320}, {0, 27, 4322}, {0, 27, 4324}, {0, 27, 4326},
+    {0, 27, 4328}, {0, 27, 4330}, {0, 27, 4332}, {0, 27, 4334}, {0, 27, 4336}, {0, 27, 4338}, {0, 27, 4340}, {0, 27, 4342},
+    {0, 27, 4344}, {0, 27, 4346}, {0, 27, 4348}, {0, 27, 4350}, {0, 27, 4352}, {0, 27, 4354}, {0, 27, 4356}, {0, 27, 4358},
+    {0, 27, 4360}, {0, 27, 4362}, {0, 27, 4364}, {0, 27, 4366}, {0, 27, 4368}, {0, 27, 4370}, {0, 27, 4372}, {0, 27, 4374},
+    {0, 27, 4376}, {0, 27, 4378}, {0, 27, 4380}, {0, 27, 4382}, {0, 27, 4384}, {0, 27, 4386}, {0, 27, 4388}, {0, 27, 4390},
+    {0, 27, 4392}, {0, 27, 4394}, {0, 27, 4396}, {0, 27, 4398}, {0, 27, 4400}, {0, 27, 4402}, {0, 27, 4404}, {0, 27, 4406},
+    {0, 27, 4408}, {0, 27, 4410}, {0, 27, 4412}, {0, 27, 4414}, {0, 27, 4416}, {0, 27, 4418}, {0, 27, 4420}, {0, 27, 4422},
+    {0, 27, 4424}, {0, 27, 4426}, {0, 27, 4428}, {0, 27, 4430}, {0, 27, 4432}, {0, 27, 4434}, {0, 27, 4436}, {0, 27, 4438},
+    {0, 27, 4440}, {0, 27, 4442}, {0, 27, 4444}, {0, 27, 4446}, {0, 27, 4448}, {0, 27, 4450}, {0, 27, 4452}, {0, 27, 4454},
+    {0, 27, 4456}, {0, 27, 4458}, {0, 27, 4460}, {0, 27, 4462}, {0, 27, 4464}, {0, 27, 4466}, {0, 27, 4468}, {0, 27, 4470},
+    {0, 27, 4472}, {0, 27, 4474}, {0, 27, 4476}, {0, 27, 4478}, {0, 27, 4480}, {0, 27, 4482}, {0, 27, 4484}, {0, 27, 4486},
+    {0, 27, 4488}, {0, 27, 4490}, {0, 27, 4492}, {0, 27, 4494}, {0, 27, 4496}, {0, 27, 4498}, {0, 27, 4500}, {0, 27, 4502},
+    {0, 27, 4504}, {0, 27, 4506}, {0, 27, 4508}, {0, 27, 4510}, {0, 27, 4512}, {0, 27, 4514}, {0, 27, 4516}, {0, 27, 4518},
+    {0, 27, 4520}, {0, 27, 4522}, {0, 27, 4524}, {0, 27, 4526}, {0, 27, 4528}, {0, 27, 4530}, {0, 27, 4532}, {0, 27, 4534},
+    {0, 27, 4536}, {0, 27, 4538}, {0, 27, 4540}, {0, 27, 4542}, {0, 27, 4544}, {0, 27, 4546}, {0, 27, 4548}, {0, 27, 4550},
+    {0, 27, 4552}, {0, 27, 4554}, {0, 27, 4556}, {0, 27, 4558}, {0, 27, 4560}, {0, 27, 4562}, {0, 27, 4564}, {0, 27, 4566},
+    {0, 27, 4568}, {0, 27, 4570}, {0, 27, 4572}, {0, 27, 4574}, {0, 27, 4576}, {0, 27, 4578}, {0, 27, 4580}, {0, 27, 4582},
+    {0, 27, 4584}, {0, 27, 4586}, {0, 27, 4588}, {0, 27, 4590}, {0, 27, 4592}, {0, 27, 4594}, {0, 27, 4596}, {0, 27, 4598},
+    {0, 27, 4600}, {0, 27, 4602}, {0, 27, 4604}, {0, 27, 4606}, {0, 27, 4608}, {0, 27, 4610}, {0, 27, 4612}, {0, 27, 4614},
+    {0, 27, 4616}, {0, 27, 4618}, {0, 27, 4620}, {0, 27, 4622}, {0, 27, 4624}, {0, 27, 4626}, {0, 27, 4628}, {0, 27, 4630},
+    {0, 27, 4632}, {0, 27, 4634}, {0, 27, 4636}, {0, 27, 4638}, {0, 27, 4640}, {0, 27, 4642}, {0, 27, 4644}, {0, 27, 4646},
+    {0, 27, 4648}, {0, 27, 4650}, {0, 27, 4652}, {0, 27, 4654}, {0, 27, 4656}, {0, 27, 4658}, {0, 27, 4660}, {0, 27, 4662},
+    {0, 27, 4664}, {0, 27, 4666}, {0, 27, 4668}, {0, 27, 4670}, {0, 27, 4672}, {0, 27, 4674}, {0, 27, 4676}, {0, 27, 4678},
+    {0, 27, 4680}, {0, 27, 4682}, {0, 27, 4684}, {0, 27, 4686}, {0, 27, 4688}, {0, 27, 4690}, {0, 27, 4692}, {0, 27, 4694},
+    {0, 27, 4696}, {0, 27, 4698}, {0, 27, 4700}, {0, 27, 4702}, {0, 27, 4704}, {0, 27, 4706}, {0, 27, 4708}, {0, 27, 4710},
+    {0, 27, 4712}, {0, 27, 4714}, {0, 27, 4716}, {0, 27, 4718}, {0, 27, 4720}, {0, 27, 4722}, {0, 27, 4724}, {0, 27, 4726},
+    {0, 27, 4728}, {0, 27, 4730}, {0, 27, 4732}, {0, 27, 4734}, {0, 27, 4736}, {0, 27, 4738}, {0, 27, 4740}, {0, 27, 4742},
+    {0, 27, 4744}, {0, 27, 4746}, {0, 27, 4748}, {0, 27, 4750}, {0, 27, 4752}, {0, 27, 4754}, {0, 27, 4756}, {0, 27, 4758},
+    {0, 27, 4760}, {0, 27, 4762}, {0, 27, 4764}, {0, 27, 4766}, {0, 27, 4768}, {0, 27, 4770}, {0, 27, 4772}, {0, 27, 4774},
+    {0, 27, 4776}, {0, 27, 4778}, {0, 27, 4780}, {0, 27, 4782}, {0, 27, 4784}, {0, 27, 4786}, {0, 27, 4788}, {0, 27, 4790},
+    {0, 27, 4792}, {0, 27, 4794}, {0, 27, 4796}, {0, 27, 4798}, {0, 27, 4800}, {0, 27, 4802}, {0, 27, 4804}, {0, 27, 4806},
+    {0, 27, 4808}, {0, 27, 4810}, {0, 27, 4812}, {0, 27, 4814}, {0, 27, 4816}, {0, 27, 4818}, {0, 27, 4820}, {0, 27, 4822},
+    {0, 27, 4824}, {0, 27, 4826}, {0, 27, 4828}, {0, 27, 4830}, {0, 27, 4832}, {0, 27, 4834}, {0, 27, 4836}, {0, 27, 4838},
+    {0, 27, 4840}, {0, 27, 4842}, {0, 27, 4844}, {0, 27, 4846}, {0, 27, 4848}, {0, 27, 4850}, {0, 27, 4852}, {0, 27, 4854},
+    {0, 27, 4856}, {0, 27, 4858}, {0, 27, 4860}, {0, 27, 4862}, {0, 27, 4864}, {0, 27, 4866}, {0, 27, 4868}, {0, 27, 4870},
+    {0, 27, 4872}, {0, 27, 4874}, {0, 27, 4876}, {0, 27, 4878}, {0, 27, 4880}, {0, 27, 4882}, {0, 27, 4884}, {0, 27, 4886},
+    {0, 27, 4888}, {0, 27, 4890}, {0, 27, 4892}, {0, 27, 4894}, {0, 27, 4896}, {0, 27, 4898}, {0, 27, 4900}, {0, 27, 4902},
+    {0, 27, 4904}, {0, 27, 4906}, {0, 27, 4908}, {0, 27, 4910}, {0, 27, 4912}, {0, 27, 4914}, {0, 27, 4916}, {0, 27, 4918},
+    {0, 27, 4920}, {0, 27, 4922}, {0, 27, 4924}, {0, 27, 4926}, {0, 27, 4928}, {0, 27, 4930}, {0, 27, 4932}, {0, 27, 4934},
+    {0, 27, 4936}, {0, 27, 4938}, {0, 27, 4940}, {0, 27, 4942}, {0, 27, 4944}, {0, 27, 4946}, {0, 27, 4948}, {0, 27, 4950},
+    {0, 27, 4952}, {0, 27, 4954}, {0, 27, 4956}, {0, 27, 4958}, {0, 27, 4960}, {0, 27, 4962}, {0, 27, 4964}, {0, 27, 4966},
+    {0, 27, 4968}, {0, 27, 4970}, {0, 27, 4972}, {0, 27, 4974}, {0, 27, 4976}, {0, 27, 4978}, {0, 27, 4980}, {0, 27, 4982},
+    {0, 27, 4984}, {0, 27, 4986}, {0, 27, 4988}, {0, 27, 4990}, {0, 27, 4992}, {0, 27, 4994}, {0, 27, 4996}, {0, 27, 4998},
+    {0, 27, 5000}, {0, 27, 5002}, {0, 27, 5004}, {0, 27, 5006}, {0, 27, 5008}, {0, 27, 5010}, {0, 27, 5012}, {0, 27, 5014},
+    {0, 27, 5016}, {0, 27, 5018}, {0, 27, 5020}, {0, 27, 5022}, {0, 27, 5024}, {0, 27, 5026}, {0, 27, 5028}, {0, 27, 5030},
+    {0, 27, 5032}, {0, 27, 5034}, {0, 27, 5036}, {0, 27, 5038}, {0, 27, 5040}, {0, 27, 5042}, {0, 27, 5044}, {0, 27, 5046},
+    {0, 27, 5048}, {0, 27, 5050}, {0, 27, 5052}, {0, 27, 5054}, {0, 27, 5056}, {0, 27, 5058}, {0, 27, 5060}, {0, 27, 5062},
+    {0, 27, 5064}, {0, 27, 5066}, {0, 27, 5068}, {0, 27, 5070}, {0, 27, 5072}, {0, 27, 5074}, {0, 27, 5076}, {0, 27, 5078},
+    {0, 27, 5080}, {0, 27, 5082}, {0, 27, 5084}, {0, 27, 5086}, {0, 27, 5088}, {0, 27, 5090}, {0, 27, 5092}, {0, 27, 5094},
+    {0, 27, 5096}, {0, 27, 5098}, {0, 27, 5100}, {0, 27, 5102}, {0, 27, 5104}, {0, 27, 5106}, {0, 27, 5108}, {0, 27, 5110},
+    {0, 27, 5112}, {0, 27, 5114}, {0, 27, 5116}, {0, 27, 5118}, {0, 27, 5120}, {0, 27, 5122}, {0, 27, 5124}, {0, 27, 5126},
+    {0, 27, 5128}, {0, 27, 5130}, {0, 27, 5132}, {0, 27, 5134}, {0, 27, 5136}, {0, 27, 5138}, {0, 27, 5140}, {0, 27, 5142},
+    {0, 27, 5144}, {0, 27, 5146}, {0, 27, 5148}, {0, 27, 5150}, {0, 27, 5152}, {0, 27, 5154}, {0, 27, 5156}, {0, 27, 5158},
+    {0, 27, 5160}, {0, 27, 5162}, {0, 27, 5164}, {0, 27, 5166}, {0, 27, 5168}, {0, 27, 5170}, {0, 27, 5172}, {0, 27, 5174},
+    {0, 27, 5176}, {0, 27, 5178}, {0, 27, 5180}, {0, 27, 5182}, {0, 27, 5184}, {0, 27, 5186}, {0, 27, 5188}, {0, 27, 5190},
+    {0, 27, 5192}, {0, 27, 5194}, {0, 27, 5196}, {0, 27, 5198}, {0, 27, 5200}, {0, 27, 5202}, {0, 27, 5204}, {0, 27, 5206},
+    {0, 27, 5208}, {0, 27, 5210},
+};
+
+static const int32_t unicode_norm_decompositions[5212] = {
+    0x0, 0x2, 0x41, 0x300, 0x2, 0x41, 0x301, 0x2, 0x41, 0x302, 0x2, 0x41,
+    0x303, 0x2, 0x41, 0x308, 0x2, 0x41, 0x30a, 0x2, 0x43, 0x327, 0x2, 0x45,
+    0x300, 0x2, 0x45, 0x301, 0x2, 0x45, 0x302, 0x2, 0x45, 0x308, 0x2, 0x49,
+    0x300, 0x2, 0x49, 0x301, 0x2, 0x49, 0x302, 0x2, 0x49, 0x308, 0x2, 0x4e,
+    0x303, 0x2, 0x4f, 0x300, 0x2, 0x4f, 0x301, 0x2, 0x4f, 0x302, 0x2, 0x4f,
+    0x303, 0x2, 0x4f, 0x308, 0x2, 0x55, 0x300, 0x2, 0x55, 0x301, 0x2, 0x55,
+    0x302, 0x2, 0x55, 0x308, 0x2, 0x59, 0x301, 0x2, 0x61, 0x300, 0x2, 0x61,
+    0x301, 0x2, 0x61, 0x302, 0x2, 0x61, 0x303, 0x2, 0x61, 0x308, 0x2, 0x61,
+    0x30a, 0x2, 0x63, 0x327, 0x2, 0x65, 0x300, 0x2, 0x65, 0x301, 0x2, 0x65,
+    0x302, 0x2, 0x65, 0x308, 0x2, 0x69, 0x300, 0x2, 0x69, 0x301, 0x2, 0x69,
+    0x302, 0x2, 0x69, 0x308, 0x2, 0x6e, 0x303, 0x2, 0x6f, 0x300, 0x2, 0x6f,
+    0x301, 0x2, 0x6f, 0x302, 0x2, 0x6f, 0x303, 0x2, 0x6f, 0x308, 0x2, 0x75,
+    0x300, 0x2, 0x75, 0x301, 0x2, 0x75, 0x302, 0x2, 0x75, 0x308, 0x2, 0x79,
+    0x301, 0x2, 0x79, 0x308, 0x2, 0x41, 0x304, 0x2, 0x61, 0x304, 0x2, 0x41,
+    0x306, 0x2, 0x61, 0x306, 0x2, 0x41, 0x328, 0x2, 0x61, 0x328, 0x2, 0x43,
+    0x301, 0x2, 0x63, 0x301, 0x2, 0x43, 0x302, 0x2, 0x63, 0x302, 0x2, 0x43,
+    0x307, 0x2, 0x63, 0x307, 0x2, 0x43, 0x30c, 0x2, 0x63, 0x30c, 0x2, 0x44,
+    0x30c, 0x2, 0x64, 0x30c, 0x2, 0x45, 0x304, 0x2, 0x65, 0x304, 0x2, 0x45,
+    0x306, 0x2, 0x65, 0x306, 0x2, 0x45, 0x307, 0x2, 0x65, 0x307, 0x2, 0x45,
+    0x328, 0x2, 0x65, 0x328, 0x2, 0x45, 0x30c, 0x2, 0x65, 0x30c, 0x2, 0x47,
+    0x302, 0x2, 0x67, 0x302, 0x2, 0x47, 0x306, 0x2, 0x67, 0x306, 0x2, 0x47,
+    0x307, 0x2, 0x67, 0x307, 0x2, 0x47, 0x327, 0x2, 0x67, 0x327, 0x2, 0x48,
+    0x302, 0x2, 0x68, 0x302, 0x2, 0x49, 0x303, 0x2, 0x69, 0x303, 0x2, 0x49,
+    0x304, 0x2, 0x69, 0x304, 0x2, 0x49, 0x306, 0x2, 0x69, 0x306, 0x2, 0x49,
+    0x328, 0x2, 0x69, 0x328, 0x2, 0x49, 0x307, 0x2, 0x4a, 0x302, 0x2, 0x6a,
+    0x302, 0x2, 0x4b, 0x327, 0x2, 0x6b, 0x327, 0x2, 0x4c, 0x301, 0x2, 0x6c,
+    0x301, 0x2, 0x4c, 0x327, 0x2, 0x6c, 0x327, 0x2, 0x4c, 0x30c, 0x2, 0x6c,
+    0x30c, 0x2, 0x4e, 0x301, 0x2, 0x6e, 0x301, 0x2, 0x4e, 0x327, 0x2, 0x6e,
+    0x327, 0x2, 0x4e, 0x30c, 0x2, 0x6e, 0x30c, 0x2, 0x4f, 0x304, 0x2, 0x6f,
+    0x304, 0x2, 0x4f, 0x306, 0x2, 0x6f, 0x306, 0x2, 0x4f, 0x30b, 0x2, 0x6f,
+    0x30b, 0x2, 0x52, 0x301, 0x2, 0x72, 0x301, 0x2, 0x52, 0x327, 0x2, 0x72,
+    0x327, 0x2, 0x52, 0x30c, 0x2, 0x72, 0x30c, 0x2, 0x53, 0x301, 0x2, 0x73,
+    0x301, 0x2, 0x53, 0x302, 0x2, 0x73, 0x302, 0x2, 0x53, 0x327, 0x2, 0x73,
+    0x327, 0x2, 0x53, 0x30c, 0x2, 0x73, 0x30c, 0x2, 0x54, 0x327, 0x2, 0x74,
+    0x327, 0x2, 0x54, 0x30c, 0x2, 0x74, 0x30c, 0x2, 0x55, 0x303, 0x2, 0x75,
+    0x303, 0x2, 0x55, 0x304, 0x2, 0x75, 0x304, 0x2, 0x55, 0x306, 0x2, 0x75,
+    0x306, 0x2, 0x55, 0x30a, 0x2, 0x75, 0x30a, 0x2, 0x55, 0x30b, 0x2, 0x75,
+    0x30b, 0x2, 0x55, 0x328, 0x2, 0x75, 0x328, 0x2, 0x57, 0x302, 0x2, 0x77,
+    0x302, 0x2, 0x59, 0x302, 0x2, 0x79, 0x302, 0x2, 0x59, 0x308, 0x2, 0x5a,
+    0x301, 0x2, 0x7a, 0x301, 0x2, 0x5a, 0x307, 0x2, 0x7a, 0x307, 0x2, 0x5a,
+    0x30c, 0x2, 0x7a, 0x30c, 0x2, 0x4f, 0x31b, 0x2, 0x6f, 0x31b, 0x2, 0x55,
+    0x31b, 0x2, 0x75, 0x31b, 0x2, 0x41, 0x30c, 0x2, 0x61, 0x30c, 0x2, 0x49,
+    0x30c, 0x2, 0x69, 0x30c, 0x2, 0x4f, 0x30c, 0x2, 0x6f, 0x30c, 0x2, 0x55,
+    0x30c, 0x2, 0x75, 0x30c, 0x3, 0x55, 0x308, 0x304, 0x3, 0x75, 0x308, 0x304,
+    0x3, 0x55, 0x308, 0x301, 0x3, 0x75, 0x308, 0x301, 0x3, 0x55, 0x308, 0x30c,
+    0x3, 0x75, 0x308, 0x30c, 0x3, 0x55, 0x308, 0x300, 0x3, 0x75, 0x308, 0x300,
+    0x3, 0x41, 0x308, 0x304, 0x3, 0x61, 0x308, 0x304, 0x3, 0x41, 0x307, 0x304,
+    0x3, 0x61, 0x307, 0x304, 0x2, 0xc6, 0x304, 0x2, 0xe6, 0x304, 0x2, 0x47,
+    0x30c, 0x2, 0x67, 0x30c, 0x2, 0x4b, 0x30c, 0x2, 0x6b, 0x30c, 0x2, 0x4f,
+    0x328, 0x2, 0x6f, 0x328, 0x3, 0x4f, 0x328, 0x304, 0x3, 0x6f, 0x328, 0x304,
+    0x2, 0x1b7, 0x30c, 0x2, 0x292, 0x30c, 0x2, 0x6a, 0x30c, 0x2, 0x47, 0x301,
+    0x2, 0x67, 0x301, 0x2, 0x4e, 0x300, 0x2, 0x6e, 0x300, 0x3, 0x41, 0x30a,
+    0x301, 0x3, 0x61, 0x30a, 0x301, 0x2, 0xc6, 0x301, 0x2, 0xe6, 0x301, 0x2,
+    0xd8, 0x301, 0x2, 0xf8, 0x301, 0x2, 0x41, 0x30f, 0x2, 0x61, 0x30f, 0x2,
+    0x41, 0x311, 0x2, 0x61, 0x311, 0x2, 0x45, 0x30f, 0x2, 0x65, 0x30f, 0x2,
+    0x45, 0x311, 0x2, 0x65, 0x311, 0x2, 0x49, 0x30f, 0x2, 0x69, 0x30f, 0x2,
+    0x49, 0x311, 0x2, 0x69, 0x311, 0x2, 0x4f, 0x30f, 0x2, 0x6f, 0x30f, 0x2,
+    0x4f, 0x311, 0x2, 0x6f, 0x311, 0x2, 0x52, 0x30f, 0x2, 0x72, 0x30f, 0x2,
+    0x52, 0x311, 0x2, 0x72, 0x311, 0x2, 0x55, 0x30f, 0x2, 0x75, 0x30f, 0x2,
+    0x55, 0x311, 0x2, 0x75, 0x311, 0x2, 0x53, 0x326, 0x2, 0x73, 0x326, 0x2,
+    0x54, 0x326, 0x2, 0x74, 0x326, 0x2, 0x48, 0x30c, 0x2, 0x68, 0x30c, 0x2,
+    0x41, 0x307, 0x2, 0x61, 0x307, 0x2, 0x45, 0x327, 0x2, 0x65, 0x327, 0x3,
+    0x4f, 0x308, 0x304, 0x3, 0x6f, 0x308, 0x304, 0x3, 0x4f, 0x303, 0x304, 0x3,
+    0x6f, 0x303, 0x304, 0x2, 0x4f, 0x307, 0x2, 0x6f, 0x307, 0x3, 0x4f, 0x307,
+    0x304, 0x3, 0x6f, 0x307, 0x304, 0x2, 0x59, 0x304, 0x2, 0x79, 0x304, 0x1,
+    0x300, 0x1, 0x301, 0x1, 0x313, 0x2, 0x308, 0x301, 0x1, 0x2b9, 0x1, 0x3b,
+    0x2, 0xa8, 0x301, 0x2, 0x391, 0x301, 0x1, 0xb7, 0x2, 0x395, 0x301, 0x2,
+    0x397, 0x301, 0x2, 0x399, 0x301, 0x2, 0x39f, 0x301, 0x2, 0x3a5, 0x301, 0x2,
+    0x3a9, 0x301, 0x3, 0x3b9, 0x308, 0x301, 0x2, 0x399, 0x308, 0x2, 0x3a5, 0x308,
+    0x2, 0x3b1, 0x301, 0x2, 0x3b5, 0x301, 0x2, 0x3b7, 0x301, 0x2, 0x3b9, 0x301,
+    0x3, 0x3c5, 0x308, 0x301, 0x2, 0x3b9, 0x308, 0x2, 0x3c5, 0x308, 0x2, 0x3bf,
+    0x301, 0x2, 0x3c5, 0x301, 0x2, 0x3c9, 0x301, 0x2, 0x3d2, 0x301, 0x2, 0x3d2,
+    0x308, 0x2, 0x415, 0x300, 0x2, 0x415, 0x308, 0x2, 0x413, 0x301, 0x2, 0x406,
+    0x308, 0x2, 0x41a, 0x301, 0x2, 0x418, 0x300, 0x2, 0x423, 0x306, 0x2, 0x418,
+    0x306, 0x2, 0x438, 0x306, 0x2, 0x435, 0x300, 0x2, 0x435, 0x308, 0x2, 0x433,
+    0x301, 0x2, 0x456, 0x308, 0x2, 0x43a, 0x301, 0x2, 0x438, 0x300, 0x2, 0x443,
+    0x306, 0x2, 0x474, 0x30f, 0x2, 0x475, 0x30f, 0x2, 0x416, 0x306, 0x2, 0x436,
+    0x306, 0x2, 0x410, 0x306, 0x2, 0x430, 0x306, 0x2, 0x410, 0x308, 0x2, 0x430,
+    0x308, 0x2, 0x415, 0x306, 0x2, 0x435, 0x306, 0x2, 0x4d8, 0x308, 0x2, 0x4d9,
+    0x308, 0x2, 0x416, 0x308, 0x2, 0x436, 0x308, 0x2, 0x417, 0x308, 0x2, 0x437,
+    0x308, 0x2, 0x418, 0x304, 0x2, 0x438, 0x304, 0x2, 0x418, 0x308, 0x2, 0x438,
+    0x308, 0x2, 0x41e, 0x308, 0x2, 0x43e, 0x308, 0x2, 0x4e8, 0x308, 0x2, 0x4e9,
+    0x308, 0x2, 0x42d, 0x308, 0x2, 0x44d, 0x308, 0x2, 0x423, 0x304, 0x2, 0x443,
+    0x304, 0x2, 0x423, 0x308, 0x2, 0x443, 0x308, 0x2, 0x423, 0x30b, 0x2, 0x443,
+    0x30b, 0x2, 0x427, 0x308, 0x2, 0x447, 0x308, 0x2, 0x42b, 0x308, 0x2, 0x44b,
+    0x308, 0x2, 0x627, 0x653, 0x2, 0x627, 0x654, 0x2, 0x648, 0x654, 0x2, 0x627,
+    0x655, 0x2, 0x64a, 0x654, 0x2, 0x6d5, 0x654, 0x2, 0x6c1, 0x654, 0x2, 0x6d2,
+    0x654, 0x2, 0x928, 0x93c, 0x2, 0x930, 0x93c, 0x2, 0x933, 0x93c, 0x2, 0x915,
+    0x93c, 0x2, 0x916, 0x93c, 0x2, 0x917, 0x93c, 0x2, 0x91c, 0x93c, 0x2, 0x921,
+    0x93c, 0x2, 0x922, 0x93c, 0x2, 0x92b, 0x93c, 0x2, 0x92f, 0x93c, 0x2, 0x9c7,
+    0x9be, 0x2, 0x9c7, 0x9d7, 0x2, 0x9a1, 0x9bc, 0x2, 0x9a2, 0x9bc, 0x2, 0x9af,
+    0x9bc, 0x2, 0xa32, 0xa3c, 0x2, 0xa38, 0xa3c, 0x2, 0xa16, 0xa3c, 0x2, 0xa17,
+    0xa3c, 0x2, 0xa1c, 0xa3c, 0x2, 0xa2b, 0xa3c, 0x2, 0xb47, 0xb56, 0x2, 0xb47,
+    0xb3e, 0x2, 0xb47, 0xb57, 0x2, 0xb21, 0xb3c, 0x2, 0xb22, 0xb3c, 0x2, 0xb92,
+    0xbd7, 0x2, 0xbc6, 0xbbe, 0x2, 0xbc7, 0xbbe, 0x2, 0xbc6, 0xbd7, 0x2, 0xc46,
+    0xc56, 0x2, 0xcbf, 0xcd5, 0x2, 0xcc6, 0xcd5, 0x2, 0xcc6, 0xcd6, 0x2, 0xcc6,
+    0xcc2, 0x3, 0xcc6, 0xcc2, 0xcd5, 0x2, 0xd46, 0xd3e, 0x2, 0xd47, 0xd3e, 0x2,
+    0xd46, 0xd57, 0x2, 0xdd9, 0xdca, 0x2, 0xdd9, 0xdcf, 0x3, 0xdd9, 0xdcf, 0xdca,
+    0x2, 0xdd9, 0xddf, 0x2, 0xf42, 0xfb7, 0x2, 0xf4c, 0xfb7, 0x2, 0xf51, 0xfb7,
+    0x2, 0xf56, 0xfb7, 0x2, 0xf5b, 0xfb7, 0x2, 0xf40, 0xfb5, 0x2, 0xf71, 0xf72,
+    0x2, 0xf71, 0xf74, 0x2, 0xfb2, 0xf80, 0x2, 0xfb3, 0xf80, 0x2, 0xf71, 0xf80,
+    0x2, 0xf92, 0xfb7, 0x2, 0xf9c, 0xfb7, 0x2, 0xfa1, 0xfb7, 0x2, 0xfa6, 0xfb7,
+    0x2, 0xfab, 0xfb7, 0x2, 0xf90, 0xfb5, 0x2, 0x1025, 0x102e, 0x2, 0x1b05, 0x1b35,
+    0x2, 0x1b07, 0x1b35, 0x2, 0x1b09, 0x1b35, 0x2, 0x1b0b, 0x1b35, 0x2, 0x1b0d, 0x1b35,
+    0x2, 0x1b11, 0x1b35, 0x2, 0x1b3a, 0x1b35, 0x2, 0x1b3c, 0x1b35, 0x2, 0x1b3e, 0x1b35,
+    0x2, 0x1b3f, 0x1b35, 0x2, 0x1b42, 0x1b35, 0x2, 0x41, 0x325, 0x2, 0x61, 0x325,
+    0x2, 0x42, 0x307, 0x2, 0x62, 0x307, 0x2, 0x42, 0x323, 0x2, 0x62, 0x323,
+    0x2, 0x42, 0x331, 0x2, 0x62, 0x331, 0x3, 0x43, 0x327, 0x301, 0x3, 0x63,
+    0x327, 0x301, 0x2, 0x44, 0x307, 0x2, 0x64, 0x307, 0x2, 0x44, 0x323, 0x2,
+    0x64, 0x323, 0x2, 0x44, 0x331, 0x2, 0x64, 0x331, 0x2, 0x44, 0x327, 0x2,
+    0x64, 0x327, 0x2, 0x44, 0x32d, 0x2, 0x64, 0x32d, 0x3, 0x45, 0x304, 0x300,
+    0x3, 0x65, 0x304, 0x300, 0x3, 0x45, 0x304, 0x301, 0x3, 0x65, 0x304, 0x301,
+    0x2, 0x45, 0x32d, 0x2, 0x65, 0x32d, 0x2, 0x45, 0x330, 0x2, 0x65, 0x330,
+    0x3, 0x45, 0x327, 0x306, 0x3, 0x65, 0x327, 0x306, 0x2, 0x46, 0x307, 0x2,
+    0x66, 0x307, 0x2, 0x47, 0x304, 0x2, 0x67, 0x304, 0x2, 0x48, 0x307, 0x2,
+    0x68, 0x307, 0x2, 0x48, 0x323, 0x2, 0x68, 0x323, 0x2, 0x48, 0x308, 0x2,
+    0x68, 0x308, 0x2, 0x48, 0x327, 0x2, 0x68, 0x327, 0x2, 0x48, 0x32e, 0x2,
+    0x68, 0x32e, 0x2, 0x49, 0x330, 0x2, 0x69, 0x330, 0x3, 0x49, 0x308, 0x301,
+    0x3, 0x69, 0x308, 0x301, 0x2, 0x4b, 0x301, 0x2, 0x6b, 0x301, 0x2, 0x4b,
+    0x323, 0x2, 0x6b, 0x323, 0x2, 0x4b, 0x331, 0x2, 0x6b, 0x331, 0x2, 0x4c,
+    0x323, 0x2, 0x6c, 0x323, 0x3, 0x4c, 0x323, 0x304, 0x3, 0x6c, 0x323, 0x304,
+    0x2, 0x4c, 0x331, 0x2, 0x6c, 0x331, 0x2, 0x4c, 0x32d, 0x2, 0x6c, 0x32d,
+    0x2, 0x4d, 0x301, 0x2, 0x6d, 0x301, 0x2, 0x4d, 0x307, 0x2, 0x6d, 0x307,
+    0x2, 0x4d, 0x323, 0x2, 0x6d, 0x323, 0x2, 0x4e, 0x307, 0x2, 0x6e, 0x307,
+    0x2, 0x4e, 0x323, 0x2, 0x6e, 0x323, 0x2, 0x4e, 0x331, 0x2, 0x6e, 0x331,
+    0x2, 0x4e, 0x32d, 0x2, 0x6e, 0x32d, 0x3, 0x4f, 0x303, 0x301, 0x3, 0x6f,
+    0x303, 0x301, 0x3, 0x4f, 0x303, 0x308, 0x3, 0x6f, 0x303, 0x308, 0x3, 0x4f,
+    0x304, 0x300, 0x3, 0x6f, 0x304, 0x300, 0x3, 0x4f, 0x304, 0x301, 0x3, 0x6f,
+    0x304, 0x301, 0x2, 0x50, 0x301, 0x2, 0x70, 0x301, 0x2, 0x50, 0x307, 0x2,
+    0x70, 0x307, 0x2, 0x52, 0x307, 0x2, 0x72, 0x307, 0x2, 0x52, 0x323, 0x2,
+    0x72, 0x323, 0x3, 0x52, 0x323, 0x304, 0x3, 0x72, 0x323, 0x304, 0x2, 0x52,
+    0x331, 0x2, 0x72, 0x331, 0x2, 0x53, 0x307, 0x2, 0x73, 0x307, 0x2, 0x53,
+    0x323, 0x2, 0x73, 0x323, 0x3, 0x53, 0x301, 0x307, 0x3, 0x73, 0x301, 0x307,
+    0x3, 0x53, 0x30c, 0x307, 0x3, 0x73, 0x30c, 0x307, 0x3, 0x53, 0x323, 0x307,
+    0x3, 0x73, 0x323, 0x307, 0x2, 0x54, 0x307, 0x2, 0x74, 0x307, 0x2, 0x54,
+    0x323, 0x2, 0x74, 0x323, 0x2, 0x54, 0x331, 0x2, 0x74, 0x331, 0x2, 0x54,
+    0x32d, 0x2, 0x74, 0x32d, 0x2, 0x55, 0x324, 0x2, 0x75, 0x324, 0x2, 0x55,
+    0x330, 0x2, 0x75, 0x330, 0x2, 0x55, 0x32d, 0x2, 0x75, 0x32d, 0x3, 0x55,
+    0x303, 0x301, 0x3, 0x75, 0x303, 0x301, 0x3, 0x55, 0x304, 0x308, 0x3, 0x75,
+    0x304, 0x308, 0x2, 0x56, 0x303, 0x2, 0x76, 0x303, 0x2, 0x56, 0x323, 0x2,
+    0x76, 0x323, 0x2, 0x57, 0x300, 0x2, 0x77, 0x300, 0x2, 0x57, 0x301, 0x2,
+    0x77, 0x301, 0x2, 0x57, 0x308, 0x2, 0x77, 0x308, 0x2, 0x57, 0x307, 0x2,
+    0x77, 0x307, 0x2, 0x57, 0x323, 0x2, 0x77, 0x323, 0x2, 0x58, 0x307, 0x2,
+    0x78, 0x307, 0x2, 0x58, 0x308, 0x2, 0x78, 0x308, 0x2, 0x59, 0x307, 0x2,
+    0x79, 0x307, 0x2, 0x5a, 0x302, 0x2, 0x7a, 0x302, 0x2, 0x5a, 0x323, 0x2,
+    0x7a, 0x323, 0x2, 0x5a, 0x331, 0x2, 0x7a, 0x331, 0x2, 0x68, 0x331, 0x2,
+    0x74, 0x308, 0x2, 0x77, 0x30a, 0x2, 0x79, 0x30a, 0x2, 0x17f, 0x307, 0x2,
+    0x41, 0x323, 0x2, 0x61, 0x323, 0x2, 0x41, 0x309, 0x2, 0x61, 0x309, 0x3,
+    0x41, 0x302, 0x301, 0x3, 0x61, 0x302, 0x301, 0x3, 0x41, 0x302, 0x300, 0x3,
+    0x61, 0x302, 0x300, 0x3, 0x41, 0x302, 0x309, 0x3, 0x61, 0x302, 0x309, 0x3,
+    0x41, 0x302, 0x303, 0x3, 0x61, 0x302, 0x303, 0x3, 0x41, 0x323, 0x302, 0x3,
+    0x61, 0x323, 0x302, 0x3, 0x41, 0x306, 0x301, 0x3, 0x61, 0x306, 0x301, 0x3,
+    0x41, 0x306, 0x300, 0x3, 0x61, 0x306, 0x300, 0x3, 0x41, 0x306, 0x309, 0x3,
+    0x61, 0x306, 0x309, 0x3, 0x41, 0x306, 0x303, 0x3, 0x61, 0x306, 0x303, 0x3,
+    0x41, 0x323, 0x306, 0x3, 0x61, 0x323, 0x306, 0x2, 0x45, 0x323, 0x2, 0x65,
+    0x323, 0x2, 0x45, 0x309, 0x2, 0x65, 0x309, 0x2, 0x45, 0x303, 0x2, 0x65,
+    0x303, 0x3, 0x45, 0x302, 0x301, 0x3, 0x65, 0x302, 0x301, 0x3, 0x45, 0x302,
+    0x300, 0x3, 0x65, 0x302, 0x300, 0x3, 0x45, 0x302, 0x309, 0x3, 0x65, 0x302,
+    0x309, 0x3, 0x45, 0x302, 0x303, 0x3, 0x65, 0x302, 0x303, 0x3, 0x45, 0x323,
+    0x302, 0x3, 0x65, 0x323, 0x302, 0x2, 0x49, 0x309, 0x2, 0x69, 0x309, 0x2,
+    0x49, 0x323, 0x2, 0x69, 0x323, 0x2, 0x4f, 0x323, 0x2, 0x6f, 0x323, 0x2,
+    0x4f, 0x309, 0x2, 0x6f, 0x309, 0x3, 0x4f, 0x302, 0x301, 0x3, 0x6f, 0x302,
+    0x301, 0x3, 0x4f, 0x302, 0x300, 0x3, 0x6f, 0x302, 0x300, 0x3, 0x4f, 0x302,
+    0x309, 0x3, 0x6f, 0x302, 0x309, 0x3, 0x4f, 0x302, 0x303, 0x3, 0x6f, 0x302,
+    0x303, 0x3, 0x4f, 0x323, 0x302, 0x3, 0x6f, 0x323, 0x302, 0x3, 0x4f, 0x31b,
+    0x301, 0x3, 0x6f, 0x31b, 0x301, 0x3, 0x4f, 0x31b, 0x300, 0x3, 0x6f, 0x31b,
+    0x300, 0x3, 0x4f, 0x31b, 0x309, 0x3, 0x6f, 0x31b, 0x309, 0x3, 0x4f, 0x31b,
+    0x303, 0x3, 0x6f, 0x31b, 0x303, 0x3, 0x4f, 0x31b, 0x323, 0x3, 0x6f, 0x31b,
+    0x323, 0x2, 0x55, 0x323, 0x2, 0x75, 0x323, 0x2, 0x55, 0x309, 0x2, 0x75,
+    0x309, 0x3, 0x55, 0x31b, 0x301, 0x3, 0x75, 0x31b, 0x301, 0x3, 0x55, 0x31b,
+    0x300, 0x3, 0x75, 0x31b, 0x300, 0x3, 0x55, 0x31b, 0x309, 0x3, 0x75, 0x31b,
+    0x309, 0x3, 0x55, 0x31b, 0x303, 0x3, 0x75, 0x31b, 0x303, 0x3, 0x55, 0x31b,
+    0x323, 0x3, 0x75, 0x31b, 0x323, 0x2, 0x59, 0x300, 0x2, 0x79, 0x300, 0x2,
+    0x59, 0x323, 0x2, 0x79, 0x323, 0x2, 0x59, 0x309, 0x2, 0x79, 0x309, 0x2,
+    0x59, 0x303, 0x2, 0x79, 0x303, 0x2, 0x3b1, 0x313, 0x2, 0x3b1, 0x314, 0x3,
+    0x3b1, 0x313, 0x300, 0x3, 0x3b1, 0x314, 0x300, 0x3, 0x3b1, 0x313, 0x301, 0x3,
+    0x3b1, 0x314, 0x301, 0x3, 0x3b1, 0x313, 0x342, 0x3, 0x3b1, 0x314, 0x342, 0x2,
+    0x391, 0x313, 0x2, 0x391, 0x314, 0x3, 0x391, 0x313, 0x300, 0x3, 0x391, 0x314,
+    0x300, 0x3, 0x391, 0x313, 0x301, 0x3, 0x391, 0x314, 0x301, 0x3, 0x391, 0x313,
+    0x342, 0x3, 0x391, 0x314, 0x342, 0x2, 0x3b5, 0x313, 0x2, 0x3b5, 0x314, 0x3,
+    0x3b5, 0x313, 0x300, 0x3, 0x3b5, 0x314, 0x300, 0x3, 0x3b5, 0x313, 0x301, 0x3,
+    0x3b5, 0x314, 0x301, 0x2, 0x395, 0x313, 0x2, 0x395, 0x314, 0x3, 0x395, 0x313,
+    0x300, 0x3, 0x395, 0x314, 0x300, 0x3, 0x395, 0x313, 0x301, 0x3, 0x395, 0x314,
+    0x301, 0x2, 0x3b7, 0x313, 0x2, 0x3b7, 0x314, 0x3, 0x3b7, 0x313, 0x300, 0x3,
+    0x3b7, 0x314, 0x300, 0x3, 0x3b7, 0x313, 0x301, 0x3, 0x3b7, 0x314, 0x301, 0x3,
+    0x3b7, 0x313, 0x342, 0x3, 0x3b7, 0x314, 0x342, 0x2, 0x397, 0x313, 0x2, 0x397,
+    0x314, 0x3, 0x397, 0x313, 0x300, 0x3, 0x397, 0x314, 0x300, 0x3, 0x397, 0x313,
+    0x301, 0x3, 0x397, 0x314, 0x301, 0x3, 0x397, 0x313, 0x342, 0x3, 0x397, 0x314,
+    0x342, 0x2, 0x3b9, 0x313, 0x2, 0x3b9, 0x314, 0x3, 0x3b9, 0x313, 0x300, 0x3,
+    0x3b9, 0x314, 0x300, 0x3, 0x3b9, 0x313, 0x301, 0x3, 0x3b9, 0x314, 0x301, 0x3,
+    0x3b9, 0x313, 0x342, 0x3, 0x3b9, 0x314, 0x342, 0x2, 0x399, 0x313, 0x2, 0x399,
+    0x314, 0x3, 0x399, 0x313, 0x300, 0x3, 0x399, 0x314, 0x300, 0x3, 0x399, 0x313,
+    0x301, 0x3, 0x399, 0x314, 0x301, 0x3, 0x399, 0x313, 0x342, 0x3, 0x399, 0x314,
+    0x342, 0x2, 0x3bf, 0x313, 0x2, 0x3bf, 0x314, 0x3, 0x3bf, 0x313, 0x300, 0x3,
+    0x3bf, 0x314, 0x300, 0x3, 0x3bf, 0x313, 0x301, 0x3, 0x3bf, 0x314, 0x301, 0x2,
+    0x39f, 0x313, 0x2, 0x39f, 0x314, 0x3, 0x39f, 0x313, 0x300, 0x3, 0x39f, 0x314,
+    0x300, 0x3, 0x39f, 0x313, 0x301, 0x3, 0x39f, 0x314, 0x301, 0x2, 0x3c5, 0x313,
+    0x2, 0x3c5, 0x314, 0x3, 0x3c5, 0x313, 0x300, 0x3, 0x3c5, 0x314, 0x300, 0x3,
+    0x3c5, 0x313, 0x301, 0x3, 0x3c5, 0x314, 0x301, 0x3, 0x3c5, 0x313, 0x342, 0x3,
+    0x3c5, 0x314, 0x342, 0x2, 0x3a5, 0x314, 0x3, 0x3a5, 0x314, 0x300, 0x3, 0x3a5,
+    0x314, 0x301, 0x3, 0x3a5, 0x314, 0x342, 0x2, 0x3c9, 0x313, 0x2, 0x3c9, 0x314,
+    0x3, 0x3c9, 0x313, 0x300, 0x3, 0x3c9, 0x314, 0x300, 0x3, 0x3c9, 0x313, 0x301,
+    0x3, 0x3c9, 0x314, 0x301, 0x3, 0x3c9, 0x313, 0x342, 0x3, 0x3c9, 0x314, 0x342,
+    0x2, 0x3a9, 0x313, 0x2, 0x3a9, 0x314, 0x3, 0x3a9, 0x313, 0x300, 0x3, 0x3a9,
+    0x314, 0x300, 0x3, 0x3a9, 0x313, 0x301, 0x3, 0x3a9, 0x314, 0x301, 0x3, 0x3a9,
+    0x313, 0x342, 0x3, 0x3a9, 0x314, 0x342, 0x2, 0x3b1, 0x300, 0x2, 0x3b5, 0x300,
+    0x2, 0x3b7, 0x300, 0x2, 0x3b9, 0x300, 0x2, 0x3bf, 0x300, 0x2, 0x3c5, 0x300,
+    0x2, 0x3c9, 0x300, 0x3, 0x3b1, 0x313, 0x345, 0x3, 0x3b1, 0x314, 0x345, 0x4,
+    0x3b1, 0x313, 0x300, 0x345, 0x4, 0x3b1, 0x314, 0x300, 0x345, 0x4, 0x3b1, 0x313,
+    0x301, 0x345, 0x4, 0x3b1, 0x314, 0x301, 0x345, 0x4, 0x3b1, 0x313, 0x342, 0x345,
+    0x4, 0x3b1, 0x314, 0x342, 0x345, 0x3, 0x391, 0x313, 0x345, 0x3, 0x391, 0x314,
+    0x345, 0x4, 0x391, 0x313, 0x300, 0x345, 0x4, 0x391, 0x314, 0x300, 0x345, 0x4,
+    0x391, 0x313, 0x301, 0x345, 0x4, 0x391, 0x314, 0x301, 0x345, 0x4, 0x391, 0x313,
+    0x342, 0x345, 0x4, 0x391, 0x314, 0x342, 0x345, 0x3, 0x3b7, 0x313, 0x345, 0x3,
+    0x3b7, 0x314, 0x345, 0x4, 0x3b7, 0x313, 0x300, 0x345, 0x4, 0x3b7, 0x314, 0x300,
+    0x345, 0x4, 0x3b7, 0x313, 0x301, 0x345, 0x4, 0x3b7, 0x314, 0x301, 0x345, 0x4,
+    0x3b7, 0x313, 0x342, 0x345, 0x4, 0x3b7, 0x314, 0x342, 0x345, 0x3, 0x397, 0x313,
+    0x345, 0x3, 0x397, 0x314, 0x345, 0x4, 0x397, 0x313, 0x300, 0x345, 0x4, 0x397,
+    0x314, 0x300, 0x345, 0x4, 0x397, 0x313, 0x301, 0x345, 0x4, 0x397, 0x314, 0x301,
+    0x345, 0x4, 0x397, 0x313, 0x342, 0x345, 0x4, 0x397, 0x314, 0x342, 0x345, 0x3,
+    0x3c9, 0x313, 0x345, 0x3, 0x3c9, 0x314, 0x345, 0x4, 0x3c9, 0x313, 0x300, 0x345,
+    0x4, 0x3c9, 0x314, 0x300, 0x345, 0x4, 0x3c9, 0x313, 0x301, 0x345, 0x4, 0x3c9,
+    0x314, 0x301, 0x345, 0x4, 0x3c9, 0x313, 0x342, 0x345, 0x4, 0x3c9, 0x314, 0x342,
+    0x345, 0x3, 0x3a9, 0x313, 0x345, 0x3, 0x3a9, 0x314, 0x345, 0x4, 0x3a9, 0x313,
+    0x300, 0x345, 0x4, 0x3a9, 0x314, 0x300, 0x345, 0x4, 0x3a9, 0x313, 0x301, 0x345,
+    0x4, 0x3a9, 0x314, 0x301, 0x345, 0x4, 0x3a9, 0x313, 0x342, 0x345, 0x4, 0x3a9,
+    0x314, 0x342, 0x345, 0x2, 0x3b1, 0x306, 0x2, 0x3b1, 0x304, 0x3, 0x3b1, 0x300,
+    0x345, 0x2, 0x3b1, 0x345, 0x3, 0x3b1, 0x301, 0x345, 0x2, 0x3b1, 0x342, 0x3,
+    0x3b1, 0x342, 0x345, 0x2, 0x391, 0x306, 0x2, 0x391, 0x304, 0x2, 0x391, 0x300,
+    0x2, 0x391, 0x345, 0x1, 0x3b9, 0x2, 0xa8, 0x342, 0x3, 0x3b7, 0x300, 0x345,
+    0x2, 0x3b7, 0x345, 0x3, 0x3b7, 0x301, 0x345, 0x2, 0x3b7, 0x342, 0x3, 0x3b7,
+    0x342, 0x345, 0x2, 0x395, 0x300, 0x2, 0x397, 0x300, 0x2, 0x397, 0x345, 0x2,
+    0x1fbf, 0x300, 0x2, 0x1fbf, 0x301, 0x2, 0x1fbf, 0x342, 0x2, 0x3b9, 0x306, 0x2,
+    0x3b9, 0x304, 0x3, 0x3b9, 0x308, 0x300, 0x2, 0x3b9, 0x342, 0x3, 0x3b9, 0x308,
+    0x342, 0x2, 0x399, 0x306, 0x2, 0x399, 0x304, 0x2, 0x399, 0x300, 0x2, 0x1ffe,
+    0x300, 0x2, 0x1ffe, 0x301, 0x2, 0x1ffe, 0x342, 0x2, 0x3c5, 0x306, 0x2, 0x3c5,
+    0x304, 0x3, 0x3c5, 0x308, 0x300, 0x2, 0x3c1, 0x313, 0x2, 0x3c1, 0x314, 0x2,
+    0x3c5, 0x342, 0x3, 0x3c5, 0x308, 0x342, 0x2, 0x3a5, 0x306, 0x2, 0x3a5, 0x304,
+    0x2, 0x3a5, 0x300, 0x2, 0x3a1, 0x314, 0x2, 0xa8, 0x300, 0x1, 0x60, 0x3,
+    0x3c9, 0x300, 0x345, 0x2, 0x3c9, 0x345, 0x3, 0x3c9, 0x301, 0x345, 0x2, 0x3c9,
+    0x342, 0x3, 0x3c9, 0x342, 0x345, 0x2, 0x39f, 0x300, 0x2, 0x3a9, 0x300, 0x2,
+    0x3a9, 0x345, 0x1, 0xb4, 0x1, 0x2002, 0x1, 0x2003, 0x1, 0x3a9, 0x1, 0x4b,
+    0x2, 0x2190, 0x338, 0x2, 0x2192, 0x338, 0x2, 0x2194, 0x338, 0x2, 0x21d0, 0x338,
+    0x2, 0x21d4, 0x338, 0x2, 0x21d2, 0x338, 0x2, 0x2203, 0x338, 0x2, 0x2208, 0x338,
+    0x2, 0x220b, 0x338, 0x2, 0x2223, 0x338, 0x2, 0x2225, 0x338, 0x2, 0x223c, 0x338,
+    0x2, 0x2243, 0x338, 0x2, 0x2245, 0x338, 0x2, 0x2248, 0x338, 0x2, 0x3d, 0x338,
+    0x2, 0x2261, 0x338, 0x2, 0x224d, 0x338, 0x2, 0x3c, 0x338, 0x2, 0x3e, 0x338,
+    0x2, 0x2264, 0x338, 0x2, 0x2265, 0x338, 0x2, 0x2272, 0x338, 0x2, 0x2273, 0x338,
+    0x2, 0x2276, 0x338, 0x2, 0x2277, 0x338, 0x2, 0x227a, 0x338, 0x2, 0x227b, 0x338,
+    0x2, 0x2282, 0x338, 0x2, 0x2283, 0x338, 0x2, 0x2286, 0x338, 0x2, 0x2287, 0x338,
+    0x2, 0x22a2, 0x338, 0x2, 0x22a8, 0x338, 0x2, 0x22a9, 0x338, 0x2, 0x22ab, 0x338,
+    0x2, 0x227c, 0x338, 0x2, 0x227d, 0x338, 0x2, 0x2291, 0x338, 0x2, 0x2292, 0x338,
+    0x2, 0x22b2, 0x338, 0x2, 0x22b3, 0x338, 0x2, 0x22b4, 0x338, 0x2, 0x22b5, 0x338,
+    0x1, 0x3008, 0x1, 0x3009, 0x2, 0x2add, 0x338, 0x2, 0x304b, 0x3099, 0x2, 0x304d,
+    0x3099, 0x2, 0x304f, 0x3099, 0x2, 0x3051, 0x3099, 0x2, 0x3053, 0x3099, 0x2, 0x3055,
+    0x3099, 0x2, 0x3057, 0x3099, 0x2, 0x3059, 0x3099, 0x2, 0x305b, 0x3099, 0x2, 0x305d,
+    0x3099, 0x2, 0x305f, 0x3099, 0x2, 0x3061, 0x3099, 0x2, 0x3064, 0x3099, 0x2, 0x3066,
+    0x3099, 0x2, 0x3068, 0x3099, 0x2, 0x306f, 0x3099, 0x2, 0x306f, 0x309a, 0x2, 0x3072,
+    0x3099, 0x2, 0x3072, 0x309a, 0x2, 0x3075, 0x3099, 0x2, 0x3075, 0x309a, 0x2, 0x3078,
+    0x3099, 0x2, 0x3078, 0x309a, 0x2, 0x307b, 0x3099, 0x2, 0x307b, 0x309a, 0x2, 0x3046,
+    0x3099, 0x2, 0x309d, 0x3099, 0x2, 0x30ab, 0x3099, 0x2, 0x30ad, 0x3099, 0x2, 0x30af,
+    0x3099, 0x2, 0x30b1, 0x3099, 0x2, 0x30b3, 0x3099, 0x2, 0x30b5, 0x3099, 0x2, 0x30b7,
+    0x3099, 0x2, 0x30b9, 0x3099, 0x2, 0x30bb, 0x3099, 0x2, 0x30bd, 0x3099, 0x2, 0x30bf,
+    0x3099, 0x2, 0x30c1, 0x3099, 0x2, 0x30c4, 0x3099, 0x2, 0x30c6, 0x3099, 0x2, 0x30c8,
+    0x3099, 0x2, 0x30cf, 0x3099, 0x2, 0x30cf, 0x309a, 0x2, 0x30d2, 0x3099, 0x2, 0x30d2,
+    0x309a, 0x2, 0x30d5, 0x3099, 0x2, 0x30d5, 0x309a, 0x2, 0x30d8, 0x3099, 0x2, 0x30d8,
+    0x309a, 0x2, 0x30db, 0x3099, 0x2, 0x30db, 0x309a, 0x2, 0x30a6, 0x3099, 0x2, 0x30ef,
+    0x3099, 0x2, 0x30f0, 0x3099, 0x2, 0x30f1, 0x3099, 0x2, 0x30f2, 0x3099, 0x2, 0x30fd,
+    0x3099, 0x1, 0x8c48, 0x1, 0x66f4, 0x1, 0x8eca, 0x1, 0x8cc8, 0x1, 0x6ed1, 0x1,
+    0x4e32, 0x1, 0x53e5, 0x1, 0x9f9c, 0x1, 0x5951, 0x1, 0x91d1, 0x1, 0x5587, 0x1,
+    0x5948, 0x1, 0x61f6, 0x1, 0x7669, 0x1, 0x7f85, 0x1, 0x863f, 0x1, 0x87ba, 0x1,
+    0x88f8, 0x1, 0x908f, 0x1, 0x6a02, 0x1, 0x6d1b, 0x1, 0x70d9, 0x1, 0x73de, 0x1,
+    0x843d, 0x1, 0x916a, 0x1, 0x99f1, 0x1, 0x4e82, 0x1, 0x5375, 0x1, 0x6b04, 0x1,
+    0x721b, 0x1, 0x862d, 0x1, 0x9e1e, 0x1, 0x5d50, 0x1, 0x6feb, 0x1, 0x85cd, 0x1,
+    0x8964, 0x1, 0x62c9, 0x1, 0x81d8, 0x1, 0x881f, 0x1, 0x5eca, 0x1, 0x6717, 0x1,
+    0x6d6a, 0x1, 0x72fc, 0x1, 0x90ce, 0x1, 0x4f86, 0x1, 0x51b7, 0x1, 0x52de, 0x1,
+    0x64c4, 0x1, 0x6ad3, 0x1, 0x7210, 0x1, 0x76e7, 0x1, 0x8001, 0x1, 0x8606, 0x1,
+    0x865c, 0x1, 0x8def, 0x1, 0x9732, 0x1, 0x9b6f, 0x1, 0x9dfa, 0x1, 0x788c, 0x1,
+    0x797f, 0x1, 0x7da0, 0x1, 0x83c9, 0x1, 0x9304, 0x1, 0x9e7f, 0x1, 0x8ad6, 0x1,
+    0x58df, 0x1, 0x5f04, 0x1, 0x7c60, 0x1, 0x807e, 0x1, 0x7262, 0x1, 0x78ca, 0x1,
+    0x8cc2, 0x1, 0x96f7, 0x1, 0x58d8, 0x1, 0x5c62, 0x1, 0x6a13, 0x1, 0x6dda, 0x1,
+    0x6f0f, 0x1, 0x7d2f, 0x1, 0x7e37, 0x1, 0x964b, 0x1, 0x52d2, 0x1, 0x808b, 0x1,
+    0x51dc, 0x1, 0x51cc, 0x1, 0x7a1c, 0x1, 0x7dbe, 0x1, 0x83f1, 0x1, 0x9675, 0x1,
+    0x8b80, 0x1, 0x62cf, 0x1, 0x8afe, 0x1, 0x4e39, 0x1, 0x5be7, 0x1, 0x6012, 0x1,
+    0x7387, 0x1, 0x7570, 0x1, 0x5317, 0x1, 0x78fb, 0x1, 0x4fbf, 0x1, 0x5fa9, 0x1,
+    0x4e0d, 0x1, 0x6ccc, 0x1, 0x6578, 0x1, 0x7d22, 0x1, 0x53c3, 0x1, 0x585e, 0x1,
+    0x7701, 0x1, 0x8449, 0x1, 0x8aaa, 0x1, 0x6bba, 0x1, 0x8fb0, 0x1, 0x6c88, 0x1,
+    0x62fe, 0x1, 0x82e5, 0x1, 0x63a0, 0x1, 0x7565, 0x1, 0x4eae, 0x1, 0x5169, 0x1,
+    0x51c9, 0x1, 0x6881, 0x1, 0x7ce7, 0x1, 0x826f, 0x1, 0x8ad2, 0x1, 0x91cf, 0x1,
+    0x52f5, 0x1, 0x5442, 0x1, 0x5973, 0x1, 0x5eec, 0x1, 0x65c5, 0x1, 0x6ffe, 0x1,
+    0x792a, 0x1, 0x95ad, 0x1, 0x9a6a, 0x1, 0x9e97, 0x1, 0x9ece, 0x1, 0x529b, 0x1,
+    0x66c6, 0x1, 0x6b77, 0x1, 0x8f62, 0x1, 0x5e74, 0x1, 0x6190, 0x1, 0x6200, 0x1,
+    0x649a, 0x1, 0x6f23, 0x1, 0x7149, 0x1, 0x7489, 0x1, 0x79ca, 0x1, 0x7df4, 0x1,
+    0x806f, 0x1, 0x8f26, 0x1, 0x84ee, 0x1, 0x9023, 0x1, 0x934a, 0x1, 0x5217, 0x1,
+    0x52a3, 0x1, 0x54bd, 0x1, 0x70c8, 0x1, 0x88c2, 0x1, 0x5ec9, 0x1, 0x5ff5, 0x1,
+    0x637b, 0x1, 0x6bae, 0x1, 0x7c3e, 0x1, 0x7375, 0x1, 0x4ee4, 0x1, 0x56f9, 0x1,
+    0x5dba, 0x1, 0x601c, 0x1, 0x73b2, 0x1, 0x7469, 0x1, 0x7f9a, 0x1, 0x8046, 0x1,
+    0x9234, 0x1, 0x96f6, 0x1, 0x9748, 0x1, 0x9818, 0x1, 0x4f8b, 0x1, 0x79ae, 0x1,
+    0x91b4, 0x1, 0x96b8, 0x1, 0x60e1, 0x1, 0x4e86, 0x1, 0x50da, 0x1, 0x5bee, 0x1,
+    0x5c3f, 0x1, 0x6599, 0x1, 0x71ce, 0x1, 0x7642, 0x1, 0x84fc, 0x1, 0x907c, 0x1,
+    0x9f8d, 0x1, 0x6688, 0x1, 0x962e, 0x1, 0x5289, 0x1, 0x677b, 0x1, 0x67f3, 0x1,
+    0x6d41, 0x1, 0x6e9c, 0x1, 0x7409, 0x1, 0x7559, 0x1, 0x786b, 0x1, 0x7d10, 0x1,
+    0x985e, 0x1, 0x516d, 0x1, 0x622e, 0x1, 0x9678, 0x1, 0x502b, 0x1, 0x5d19, 0x1,
+    0x6dea, 0x1, 0x8f2a, 0x1, 0x5f8b, 0x1, 0x6144, 0x1, 0x6817, 0x1, 0x9686, 0x1,
+    0x5229, 0x1, 0x540f, 0x1, 0x5c65, 0x1, 0x6613, 0x1, 0x674e, 0x1, 0x68a8, 0x1,
+    0x6ce5, 0x1, 0x7406, 0x1, 0x75e2, 0x1, 0x7f79, 0x1, 0x88cf, 0x1, 0x88e1, 0x1,
+    0x91cc, 0x1, 0x96e2, 0x1, 0x533f, 0x1, 0x6eba, 0x1, 0x541d, 0x1, 0x71d0, 0x1,
+    0x7498, 0x1, 0x85fa, 0x1, 0x96a3, 0x1, 0x9c57, 0x1, 0x9e9f, 0x1, 0x6797, 0x1,
+    0x6dcb, 0x1, 0x81e8, 0x1, 0x7acb, 0x1, 0x7b20, 0x1, 0x7c92, 0x1, 0x72c0, 0x1,
+    0x7099, 0x1, 0x8b58, 0x1, 0x4ec0, 0x1, 0x8336, 0x1, 0x523a, 0x1, 0x5207, 0x1,
+    0x5ea6, 0x1, 0x62d3, 0x1, 0x7cd6, 0x1, 0x5b85, 0x1, 0x6d1e, 0x1, 0x66b4, 0x1,
+    0x8f3b, 0x1, 0x884c, 0x1, 0x964d, 0x1, 0x898b, 0x1, 0x5ed3, 0x1, 0x5140, 0x1,
+    0x55c0, 0x1, 0x585a, 0x1, 0x6674, 0x1, 0x51de, 0x1, 0x732a, 0x1, 0x76ca, 0x1,
+    0x793c, 0x1, 0x795e, 0x1, 0x7965, 0x1, 0x798f, 0x1, 0x9756, 0x1, 0x7cbe, 0x1,
+    0x7fbd, 0x1, 0x8612, 0x1, 0x8af8, 0x1, 0x9038, 0x1, 0x90fd, 0x1, 0x98ef, 0x1,
+    0x98fc, 0x1, 0x9928, 0x1, 0x9db4, 0x1, 0x90de, 0x1, 0x96b7, 0x1, 0x4fae, 0x1,
+    0x50e7, 0x1, 0x514d, 0x1, 0x52c9, 0x1, 0x52e4, 0x1, 0x5351, 0x1, 0x559d, 0x1,
+    0x5606, 0x1, 0x5668, 0x1, 0x5840, 0x1, 0x58a8, 0x1, 0x5c64, 0x1, 0x5c6e, 0x1,
+    0x6094, 0x1, 0x6168, 0x1, 0x618e, 0x1, 0x61f2, 0x1, 0x654f, 0x1, 0x65e2, 0x1,
+    0x6691, 0x1, 0x6885, 0x1, 0x6d77, 0x1, 0x6e1a, 0x1, 0x6f22, 0x1, 0x716e, 0x1,
+    0x722b, 0x1, 0x7422, 0x1, 0x7891, 0x1, 0x793e, 0x1, 0x7949, 0x1, 0x7948, 0x1,
+    0x7950, 0x1, 0x7956, 0x1, 0x795d, 0x1, 0x798d, 0x1, 0x798e, 0x1, 0x7a40, 0x1,
+    0x7a81, 0x1, 0x7bc0, 0x1, 0x7e09, 0x1, 0x7e41, 0x1, 0x7f72, 0x1, 0x8005, 0x1,
+    0x81ed, 0x1, 0x8279, 0x1, 0x8457, 0x1, 0x8910, 0x1, 0x8996, 0x1, 0x8b01, 0x1,
+    0x8b39, 0x1, 0x8cd3, 0x1, 0x8d08, 0x1, 0x8fb6, 0x1, 0x96e3, 0x1, 0x97ff, 0x1,
+    0x983b, 0x1, 0x6075, 0x1, 0x242ee, 0x1, 0x8218, 0x1, 0x4e26, 0x1, 0x51b5, 0x1,
+    0x5168, 0x1, 0x4f80, 0x1, 0x5145, 0x1, 0x5180, 0x1, 0x52c7, 0x1, 0x52fa, 0x1,
+    0x5555, 0x1, 0x5599, 0x1, 0x55e2, 0x1, 0x58b3, 0x1, 0x5944, 0x1, 0x5954, 0x1,
+    0x5a62, 0x1, 0x5b28, 0x1, 0x5ed2, 0x1, 0x5ed9, 0x1, 0x5f69, 0x1, 0x5fad, 0x1,
+    0x60d8, 0x1, 0x614e, 0x1, 0x6108, 0x1, 0x6160, 0x1, 0x6234, 0x1, 0x63c4, 0x1,
+    0x641c, 0x1, 0x6452, 0x1, 0x6556, 0x1, 0x671b, 0x1, 0x6756, 0x1, 0x6b79, 0x1,
+    0x6edb, 0x1, 0x6ecb, 0x1, 0x701e, 0x1, 0x77a7, 0x1, 0x7235, 0x1, 0x72af, 0x1,
+    0x7471, 0x1, 0x7506, 0x1, 0x753b, 0x1, 0x761d, 0x1, 0x761f, 0x1, 0x76db, 0x1,
+    0x76f4, 0x1, 0x774a, 0x1, 0x7740, 0x1, 0x78cc, 0x1, 0x7ab1, 0x1, 0x7c7b, 0x1,
+    0x7d5b, 0x1, 0x7f3e, 0x1, 0x8352, 0x1, 0x83ef, 0x1, 0x8779, 0x1, 0x8941, 0x1,
+    0x8986, 0x1, 0x8abf, 0x1, 0x8acb, 0x1, 0x8aed, 0x1, 0x8b8a, 0x1, 0x8f38, 0x1,
+    0x9072, 0x1, 0x9199, 0x1, 0x9276, 0x1, 0x967c, 0x1, 0x97db, 0x1, 0x980b, 0x1,
+    0x9b12, 0x1, 0x2284a, 0x1, 0x22844, 0x1, 0x233d5, 0x1, 0x3b9d, 0x1, 0x4018, 0x1,
+    0x4039, 0x1, 0x25249, 0x1, 0x25cd0, 0x1, 0x27ed3, 0x1, 0x9f43, 0x1, 0x9f8e, 0x2,
+    0x5d9, 0x5b4, 0x2, 0x5f2, 0x5b7, 0x2, 0x5e9, 0x5c1, 0x2, 0x5e9, 0x5c2, 0x3,
+    0x5e9, 0x5bc, 0x5c1, 0x3, 0x5e9, 0x5bc, 0x5c2, 0x2, 0x5d0, 0x5b7, 0x2, 0x5d0,
+    0x5b8, 0x2, 0x5d0, 0x5bc, 0x2, 0x5d1, 0x5bc, 0x2, 0x5d2, 0x5bc, 0x2, 0x5d3,
+    0x5bc, 0x2, 0x5d4, 0x5bc, 0x2, 0x5d5, 0x5bc, 0x2, 0x5d6, 0x5bc, 0x2, 0x5d8,
+    0x5bc, 0x2, 0x5d9, 0x5bc, 0x2, 0x5da, 0x5bc, 0x2, 0x5db, 0x5bc, 0x2, 0x5dc,
+    0x5bc, 0x2, 0x5de, 0x5bc, 0x2, 0x5e0, 0x5bc, 0x2, 0x5e1, 0x5bc, 0x2, 0x5e3,
+    0x5bc, 0x2, 0x5e4, 0x5bc, 0x2, 0x5e6, 0x5bc, 0x2, 0x5e7, 0x5bc, 0x2, 0x5e8,
+    0x5bc, 0x2, 0x5e9, 0x5bc, 0x2, 0x5ea, 0x5bc, 0x2, 0x5d5, 0x5b9, 0x2, 0x5d1,
+    0x5bf, 0x2, 0x5db, 0x5bf, 0x2, 0x5e4, 0x5bf, 0x2, 0x11099, 0x110ba, 0x2, 0x1109b,
+    0x110ba, 0x2, 0x110a5, 0x110ba, 0x2, 0x11131, 0x11127, 0x2, 0x11132, 0x11127, 0x2, 0x11347,
+    0x1133e, 0x2, 0x11347, 0x11357, 0x2, 0x114b9, 0x114ba, 0x2, 0x114b9, 0x114b0, 0x2, 0x114b9,
+    0x114bd, 0x2, 0x115b8, 0x115af, 0x2, 0x115b9, 0x115af, 0x2, 0x11935, 0x11930, 0x2, 0x1d157,
+    0x1d165, 0x2, 0x1d158, 0x1d165, 0x3, 0x1d158, 0x1d165, 0x1d16e, 0x3, 0x1d158, 0x1d165, 0x1d16f,
+    0x3, 0x1d158, 0x1d165, 0x1d170, 0x3, 0x1d158, 0x1d165, 0x1d171, 0x3, 0x1d158, 0x1d165, 0x1d172,
+    0x2, 0x1d1b9, 0x1d165, 0x2, 0x1d1ba, 0x1d165, 0x3, 0x1d1b9, 0x1d165, 0x1d16e, 0x3, 0x1d1ba,
+    0x1d165, 0x1d16e, 0x3, 0x1d1b9, 0x1d165, 0x1d16f, 0x3, 0x1d1ba, 0x1d165, 0x1d16f, 0x1, 0x4e3d,
+    0x1, 0x4e38, 0x1, 0x4e41, 0x1, 0x20122, 0x1, 0x4f60, 0x1, 0x4fbb, 0x1, 0x5002,
+    0x1, 0x507a, 0x1, 0x5099, 0x1, 0x50cf, 0x1, 0x349e, 0x1, 0x2063a, 0x1, 0x5154,
+    0x1, 0x5164, 0x1, 0x5177, 0x1, 0x2051c, 0x1, 0x34b9, 0x1, 0x5167, 0x1, 0x518d,
+    0x1, 0x2054b, 0x1, 0x5197, 0x1, 0x51a4, 0x1, 0x4ecc, 0x1, 0x51ac, 0x1, 0x291df,
+    0x1, 0x51f5, 0x1, 0x5203, 0x1, 0x34df, 0x1, 0x523b, 0x1, 0x5246, 0x1, 0x5272,
+    0x1, 0x5277, 0x1, 0x3515, 0x1, 0x5305, 0x1, 0x5306, 0x1, 0x5349, 0x1, 0x535a,
+    0x1, 0x5373, 0x1, 0x537d, 0x1, 0x537f, 0x1, 0x20a2c, 0x1, 0x7070, 0x1, 0x53ca,
+    0x1, 0x53df, 0x1, 0x20b63, 0x1, 0x53eb, 0x1, 0x53f1, 0x1, 0x5406, 0x1, 0x549e,
+    0x1, 0x5438, 0x1, 0x5448, 0x1, 0x5468, 0x1, 0x54a2, 0x1, 0x54f6, 0x1, 0x5510,
+    0x1, 0x5553, 0x1, 0x5563, 0x1, 0x5584, 0x1, 0x55ab, 0x1, 0x55b3, 0x1, 0x55c2,
+    0x1, 0x5716, 0x1, 0x5717, 0x1, 0x5651, 0x1, 0x5674, 0x1, 0x58ee, 0x1, 0x57ce,
+    0x1, 0x57f4, 0x1, 0x580d, 0x1, 0x578b, 0x1, 0x5832, 0x1, 0x5831, 0x1, 0x58ac,
+    0x1, 0x214e4, 0x1, 0x58f2, 0x1, 0x58f7, 0x1, 0x5906, 0x1, 0x591a, 0x1, 0x5922,
+    0x1, 0x5962, 0x1, 0x216a8, 0x1, 0x216ea, 0x1, 0x59ec, 0x1, 0x5a1b, 0x1, 0x5a27,
+    0x1, 0x59d8, 0x1, 0x5a66, 0x1, 0x36ee, 0x1, 0x36fc, 0x1, 0x5b08, 0x1, 0x5b3e,
+    0x1, 0x219c8, 0x1, 0x5bc3, 0x1, 0x5bd8, 0x1, 0x5bf3, 0x1, 0x21b18, 0x1, 0x5bff,
+    0x1, 0x5c06, 0x1, 0x5f53, 0x1, 0x5c22, 0x1, 0x3781, 0x1, 0x5c60, 0x1, 0x5cc0,
+    0x1, 0x5c8d, 0x1, 0x21de4, 0x1, 0x5d43, 0x1, 0x21de6, 0x1, 0x5d6e, 0x1, 0x5d6b,
+    0x1, 0x5d7c, 0x1, 0x5de1, 0x1, 0x5de2, 0x1, 0x382f, 0x1, 0x5dfd, 0x1, 0x5e28,
+    0x1, 0x5e3d, 0x1, 0x5e69, 0x1, 0x3862, 0x1, 0x22183, 0x1, 0x387c, 0x1, 0x5eb0,
+    0x1, 0x5eb3, 0x1, 0x5eb6, 0x1, 0x2a392, 0x1, 0x5efe, 0x1, 0x22331, 0x1, 0x8201,
+    0x1, 0x5f22, 0x1, 0x38c7, 0x1, 0x232b8, 0x1, 0x261da, 0x1, 0x5f62, 0x1, 0x5f6b,
+    0x1, 0x38e3, 0x1, 0x5f9a, 0x1, 0x5fcd, 0x1, 0x5fd7, 0x1, 0x5ff9, 0x1, 0x6081,
+    0x1, 0x393a, 0x1, 0x391c, 0x1, 0x226d4, 0x1, 0x60c7, 0x1, 0x6148, 0x1, 0x614c,
+    0x1, 0x617a, 0x1, 0x61b2, 0x1, 0x61a4, 0x1, 0x61af, 0x1, 0x61de, 0x1, 0x6210,
+    0x1, 0x621b, 0x1, 0x625d, 0x1, 0x62b1, 0x1, 0x62d4, 0x1, 0x6350, 0x1, 0x22b0c,
+    0x1, 0x633d, 0x1, 0x62fc, 0x1, 0x6368, 0x1, 0x6383, 0x1, 0x63e4, 0x1, 0x22bf1,
+    0x1, 0x6422, 0x1, 0x63c5, 0x1, 0x63a9, 0x1, 0x3a2e, 0x1, 0x6469, 0x1, 0x647e,
+    0x1, 0x649d, 0x1, 0x6477, 0x1, 0x3a6c, 0x1, 0x656c, 0x1, 0x2300a, 0x1, 0x65e3,
+    0x1, 0x66f8, 0x1, 0x6649, 0x1, 0x3b19, 0x1, 0x3b08, 0x1, 0x3ae4, 0x1, 0x5192,
+    0x1, 0x5195, 0x1, 0x6700, 0x1, 0x669c, 0x1, 0x80ad, 0x1, 0x43d9, 0x1, 0x6721,
+    0x1, 0x675e, 0x1, 0x6753, 0x1, 0x233c3, 0x1, 0x3b49, 0x1, 0x67fa, 0x1, 0x6785,
+    0x1, 0x6852, 0x1, 0x2346d, 0x1, 0x688e, 0x1, 0x681f, 0x1, 0x6914, 0x1, 0x6942,
+    0x1, 0x69a3, 0x1, 0x69ea, 0x1, 0x6aa8, 0x1, 0x236a3, 0x1, 0x6adb, 0x1, 0x3c18,
+    0x1, 0x6b21, 0x1, 0x238a7, 0x1, 0x6b54, 0x1, 0x3c4e, 0x1, 0x6b72, 0x1, 0x6b9f,
+    0x1, 0x6bbb, 0x1, 0x23a8d, 0x1, 0x21d0b, 0x1, 0x23afa, 0x1, 0x6c4e, 0x1, 0x23cbc,
+    0x1, 0x6cbf, 0x1, 0x6ccd, 0x1, 0x6c67, 0x1, 0x6d16, 0x1, 0x6d3e, 0x1, 0x6d69,
+    0x1, 0x6d78, 0x1, 0x6d85, 0x1, 0x23d1e, 0x1, 0x6d34, 0x1, 0x6e2f, 0x1, 0x6e6e,
+    0x1, 0x3d33, 0x1, 0x6ec7, 0x1, 0x23ed1, 0x1, 0x6df9, 0x1, 0x6f6e, 0x1, 0x23f5e,
+    0x1, 0x23f8e, 0x1, 0x6fc6, 0x1, 0x7039, 0x1, 0x701b, 0x1, 0x3d96, 0x1, 0x704a,
+    0x1, 0x707d, 0x1, 0x7077, 0x1, 0x70ad, 0x1, 0x20525, 0x1, 0x7145, 0x1, 0x24263,
+    0x1, 0x719c, 0x1, 0x243ab, 0x1, 0x7228, 0x1, 0x7250, 0x1, 0x24608, 0x1, 0x7280,
+    0x1, 0x7295, 0x1, 0x24735, 0x1, 0x24814, 0x1, 0x737a, 0x1, 0x738b, 0x1, 0x3eac,
+    0x1, 0x73a5, 0x1, 0x3eb8, 0x1, 0x7447, 0x1, 0x745c, 0x1, 0x7485, 0x1, 0x74ca,
+    0x1, 0x3f1b, 0x1, 0x7524, 0x1, 0x24c36, 0x1, 0x753e, 0x1, 0x24c92, 0x1, 0x2219f,
+    0x1, 0x7610, 0x1, 0x24fa1, 0x1, 0x24fb8, 0x1, 0x25044, 0x1, 0x3ffc, 0x1, 0x4008,
+    0x1, 0x250f3, 0x1, 0x250f2, 0x1, 0x25119, 0x1, 0x25133, 0x1, 0x771e, 0x1, 0x771f,
+    0x1, 0x778b, 0x1, 0x4046, 0x1, 0x4096, 0x1, 0x2541d, 0x1, 0x784e, 0x1, 0x40e3,
+    0x1, 0x25626, 0x1, 0x2569a, 0x1, 0x256c5, 0x1, 0x79eb, 0x1, 0x412f, 0x1, 0x7a4a,
+    0x1, 0x7a4f, 0x1, 0x2597c, 0x1, 0x25aa7, 0x1, 0x7aee, 0x1, 0x4202, 0x1, 0x25bab,
+    0x1, 0x7bc6, 0x1, 0x7bc9, 0x1, 0x4227, 0x1, 0x25c80, 0x1, 0x7cd2, 0x1, 0x42a0,
+    0x1, 0x7ce8, 0x1, 0x7ce3, 0x1, 0x7d00, 0x1, 0x25f86, 0x1, 0x7d63, 0x1, 0x4301,
+    0x1, 0x7dc7, 0x1, 0x7e02, 0x1, 0x7e45, 0x1, 0x4334, 0x1, 0x26228, 0x1, 0x26247,
+    0x1, 0x4359, 0x1, 0x262d9, 0x1, 0x7f7a, 0x1, 0x2633e, 0x1, 0x7f95, 0x1, 0x7ffa,
+    0x1, 0x264da, 0x1, 0x26523, 0x1, 0x8060, 0x1, 0x265a8, 0x1, 0x8070, 0x1, 0x2335f,
+    0x1, 0x43d5, 0x1, 0x80b2, 0x1, 0x8103, 0x1, 0x440b, 0x1, 0x813e, 0x1, 0x5ab5,
+    0x1, 0x267a7, 0x1, 0x267b5, 0x1, 0x23393, 0x1, 0x2339c, 0x1, 0x8204, 0x1, 0x8f9e,
+    0x1, 0x446b, 0x1, 0x8291, 0x1, 0x828b, 0x1, 0x829d, 0x1, 0x52b3, 0x1, 0x82b1,
+    0x1, 0x82b3, 0x1, 0x82bd, 0x1, 0x82e6, 0x1, 0x26b3c, 0x1, 0x831d, 0x1, 0x8363,
+    0x1, 0x83ad, 0x1, 0x8323, 0x1, 0x83bd, 0x1, 0x83e7, 0x1, 0x8353, 0x1, 0x83ca,
+    0x1, 0x83cc, 0x1, 0x83dc, 0x1, 0x26c36, 0x1, 0x26d6b, 0x1, 0x26cd5, 0x1, 0x452b,
+    0x1, 0x84f1, 0x1, 0x84f3, 0x1, 0x8516, 0x1, 0x273ca, 0x1, 0x8564, 0x1, 0x26f2c,
+    0x1, 0x455d, 0x1, 0x4561, 0x1, 0x26fb1, 0x1, 0x270d2, 0x1, 0x456b, 0x1, 0x8650,
+    0x1, 0x8667, 0x1, 0x8669, 0x1, 0x86a9, 0x1, 0x8688, 0x1, 0x870e, 0x1, 0x86e2,
+    0x1, 0x8728, 0x1, 0x876b, 0x1, 0x8786, 0x1, 0x45d7, 0x1, 0x87e1, 0x1, 0x8801,
+    0x1, 0x45f9, 0x1, 0x8860, 0x1, 0x8863, 0x1, 0x27667, 0x1, 0x88d7, 0x1, 0x88de,
+    0x1, 0x4635, 0x1, 0x88fa, 0x1, 0x34bb, 0x1, 0x278ae, 0x1, 0x27966, 0x1, 0x46be,
+    0x1, 0x46c7, 0x1, 0x8aa0, 0x1, 0x8c55, 0x1, 0x27ca8, 0x1, 0x8cab, 0x1, 0x8cc1,
+    0x1, 0x8d1b, 0x1, 0x8d77, 0x1, 0x27f2f, 0x1, 0x20804, 0x1, 0x8dcb, 0x1, 0x8dbc,
+    0x1, 0x8df0, 0x1, 0x208de, 0x1, 0x8ed4, 0x1, 0x285d2, 0x1, 0x285ed, 0x1, 0x9094,
+    0x1, 0x90f1, 0x1, 0x9111, 0x1, 0x2872e, 0x1, 0x911b, 0x1, 0x9238, 0x1, 0x92d7,
+    0x1, 0x92d8, 0x1, 0x927c, 0x1, 0x93f9, 0x1, 0x9415, 0x1, 0x28bfa, 0x1, 0x958b,
+    0x1, 0x4995, 0x1, 0x95b7, 0x1, 0x28d77, 0x1, 0x49e6, 0x1, 0x96c3, 0x1, 0x5db2,
+    0x1, 0x9723, 0x1, 0x29145, 0x1, 0x2921a, 0x1, 0x4a6e, 0x1, 0x4a76, 0x1, 0x97e0,
+    0x1, 0x2940a, 0x1, 0x4ab2, 0x1, 0x29496, 0x1, 0x9829, 0x1, 0x295b6, 0x1, 0x98e2,
+    0x1, 0x4b33, 0x1, 0x9929, 0x1, 0x99a7, 0x1, 0x99c2, 0x1, 0x99fe, 0x1, 0x4bce,
+    0x1, 0x29b30, 0x1, 0x9c40, 0x1, 0x9cfd, 0x1, 0x4cce, 0x1, 0x4ced, 0x1, 0x9d67,
+    0x1, 0x2a0ce, 0x1, 0x4cf8, 0x1, 0x2a105, 0x1, 0x2a20e, 0x1, 0x2a291, 0x1, 0x9ebb,
+    0x1, 0x4d56, 0x1, 0x9ef9, 0x1, 0x9efe, 0x1, 0x9f05, 0x1, 0x9f0f, 0x1, 0x9f16,
+    0x1, 0x9f3b, 0x1, 0x2a600,
+};
+
+// primary composites sorted by (first, second), hangul is done algorithmically
+struct unicode_norm_composition
+{
+    int32_t first, second, composite;
+};
+
+static const struct unicode_norm_composition unicode_norm_compositions[941] = {
+    {0x3c, 0x338, 0x226e}, {0x3d, 0x338, 0x2260}, {0x3e, 0x338, 0x226f}, {0x41, 0x300, 0xc0},
+    {0x41, 0x301, 0xc1}, {0x41, 0x302, 0xc2}, {0x41, 0x303, 0xc3}, {0x41, 0x304, 0x100},
+    {0x41, 0x306, 0x102}, {0x41, 0x307, 0x226}, {0x41, 0x308, 0xc4}, {0x41, 0x309, 0x1ea2},
+    {0x41, 0x30a, 0xc5}, {0x41, 0x30c, 0x1cd}, {0x41, 0x30f, 0x200}, {0x41, 0x311, 0x202},
+    {0x41, 0x323, 0x1ea0}, {0x41, 0x325, 0x1e00}, {0x41, 0x328, 0x104}, {0x42, 0x307, 0x1e02},
+    {0x42, 0x323, 0x1e04}, {0x42, 0x331, 0x1e06}, {0x43, 0x301, 0x106}, {0x43, 0x302, 0x108},
+    {0x43, 0x307, 0x10a}, {0x43, 0x30c, 0x10c}, {0x43, 0x327, 0xc7}, {0x44, 0x307, 0x1e0a},
+    {0x44, 0x30c, 0x10e}, {0x44, 0x323, 0x1e0c}, {0x44, 0x327, 0x1e10}, {0x44, 0x32d, 0x1e12},
+    {0x44, 0x331, 0x1e0e}, {0x45, 0x300, 0xc8}, {0x45, 0x301, 0xc9}, {0x45, 0x302, 0xca},
+    {0x45, 0x303, 0x1ebc}, {0x45, 0x304, 0x112}, {0x45, 0x306, 0x114}, {0x45, 0x307, 0x116},
+    {0x45, 0x308, 0xcb}, {0x45, 0x309, 0x1eba}, {0x45, 0x30c, 0x11a}, {0x45, 0x30f, 0x204},
+    {0x45, 0x311, 0x206}, {0x45, 0x323, 0x1eb8}, {0x45, 0x327, 0x228}, {0x45, 0x328, 0x118},
+    {0x45, 0x32d, 0x1e18}, {0x45, 0x330, 0x1e1a}, {0x46, 0x307, 0x1e1e}, {0x47, 0x301, 0x1f4},
+    {0x47, 0x302, 0x11c}, {0x47, 0x304, 0x1e20}, {0x47, 0x306, 0x11e}, {0x47, 0x307, 0x120},
+    {0x47, 0x30c, 0x1e6}, {0x47, 0x327, 0x122}, {0x48, 0x302, 0x124}, {0x48, 0x307, 0x1e22},
+    {0x48, 0x308, 0x1e26}, {0x48, 0x30c, 0x21e}, {0x48, 0x323, 0x1e24}, {0x48, 0x327, 0x1e28},
+    {0x48, 0x32e, 0x1e2a}, {0x49, 0x300, 0xcc}, {0x49, 0x301, 0xcd}, {0x49, 0x302, 0xce},
+    {0x49, 0x303, 0x128}, {0x49, 0x304, 0x12a}, {0x49, 0x306, 0x12c}, {0x49, 0x307, 0x130},
+    {0x49, 0x308, 0xcf}, {0x49, 0x309, 0x1ec8}, {0x49, 0x30c, 0x1cf}, {0x49, 0x30f, 0x208},
+    {0x49, 0x311, 0x20a}, {0x49, 0x323, 0x1eca}, {0x49, 0x328, 0x12e}, {0x49, 0x330, 0x1e2c},
+    {0x4a, 0x302, 0x134}, {0x4b, 0x301, 0x1e30}, {0x4b, 0x30c, 0x1e8}, {0x4b, 0x323, 0x1e32},
+    {0x4b, 0x327, 0x136}, {0x4b, 0x331, 0x1e34}, {0x4c, 0x301, 0x139}, {0x4c, 0x30c, 0x13d},
+    {0x4c, 0x323, 0x1e36}, {0x4c, 0x327, 0x13b}, {0x4c, 0x32d, 0x1e3c}, {0x4c, 0x331, 0x1e3a},
+    {0x4d, 0x301, 0x1e3e}, {0x4d, 0x307, 0x1e40}, {0x4d, 0x323, 0x1e42}, {0x4e, 0x300, 0x1f8},
+    {0x4e, 0x301, 0x143}, {0x4e, 0x303, 0xd1}, {0x4e, 0x307, 0x1e44}, {0x4e, 0x30c, 0x147},
+    {0x4e, 0x323, 0x1e46}, {0x4e, 0x327, 0x145}, {0x4e, 0x32d, 0x1e4a}, {0x4e, 0x331, 0x1e48},
+    {0x4f, 0x300, 0xd2}, {0x4f, 0x301, 0xd3}, {0x4f, 0x302, 0xd4}, {0x4f, 0x303, 0xd5},
+    {0x4f, 0x304, 0x14c}, {0x4f, 0x306, 0x14e}, {0x4f, 0x307, 0x22e}, {0x4f, 0x308, 0xd6},
+    {0x4f, 0x309, 0x1ece}, {0x4f, 0x30b, 0x150}, {0x4f, 0x30c, 0x1d1}, {0x4f, 0x30f, 0x20c},
+    {0x4f, 0x311, 0x20e}, {0x4f, 0x31b, 0x1a0}, {0x4f, 0x323, 0x1ecc}, {0x4f, 0x328, 0x1ea},
+    {0x50, 0x301, 0x1e54}, {0x50, 0x307, 0x1e56}, {0x52, 0x301, 0x154}, {0x52, 0x307, 0x1e58},
+    {0x52, 0x30c, 0x158}, {0x52, 0x30f, 0x210}, {0x52, 0x311, 0x212}, {0x52, 0x323, 0x1e5a},
+    {0x52, 0x327, 0x156}, {0x52, 0x331, 0x1e5e}, {0x53, 0x301, 0x15a}, {0x53, 0x302, 0x15c},
+    {0x53, 0x307, 0x1e60}, {0x53, 0x30c, 0x160}, {0x53, 0x323, 0x1e62}, {0x53, 0x326, 0x218},
+    {0x53, 0x327, 0x15e}, {0x54, 0x307, 0x1e6a}, {0x54, 0x30c, 0x164}, {0x54, 0x323, 0x1e6c},
+    {0x54, 0x326, 0x21a}, {0x54, 0x327, 0x162}, {0x54, 0x32d, 0x1e70}, {0x54, 0x331, 0x1e6e},
+    {0x55, 0x300, 0xd9}, {0x55, 0x301, 0xda}, {0x55, 0x302, 0xdb}, {0x55, 0x303, 0x168},
+    {0x55, 0x304, 0x16a}, {0x55, 0x306, 0x16c}, {0x55, 0x308, 0xdc}, {0x55, 0x309, 0x1ee6},
+    {0x55, 0x30a, 0x16e}, {0x55, 0x30b, 0x170}, {0x55, 0x30c, 0x1d3}, {0x55, 0x30f, 0x214},
+    {0x55, 0x311, 0x216}, {0x55, 0x31b, 0x1af}, {0x55, 0x323, 0x1ee4}, {0x55, 0x324, 0x1e72},
+    {0x55, 0x328, 0x172}, {0x55, 0x32d, 0x1e76}, {0x55, 0x330, 0x1e74}, {0x56, 0x303, 0x1e7c},
+    {0x56, 0x323, 0x1e7e}, {0x57, 0x300, 0x1e80}, {0x57, 0x301, 0x1e82}, {0x57, 0x302, 0x174},
+    {0x57, 0x307, 0x1e86}, {0x57, 0x308, 0x1e84}, {0x57, 0x323, 0x1e88}, {0x58, 0x307, 0x1e8a},
+    {0x58, 0x308, 0x1e8c}, {0x59, 0x300, 0x1ef2}, {0x59, 0x301, 0xdd}, {0x59, 0x302, 0x176},
+    {0x59, 0x303, 0x1ef8}, {0x59, 0x304, 0x232}, {0x59, 0x307, 0x1e8e}, {0x59, 0x308, 0x178},
+    {0x59, 0x309, 0x1ef6}, {0x59, 0x323, 0x1ef4}, {0x5a, 0x301, 0x179}, {0x5a, 0x302, 0x1e90},
+    {0x5a, 0x307, 0x17b}, {0x5a, 0x30c, 0x17d}, {0x5a, 0x323, 0x1e92}, {0x5a, 0x331, 0x1e94},
+    {0x61, 0x300, 0xe0}, {0x61, 0x301, 0xe1}, {0x61, 0x302, 0xe2}, {0x61, 0x303, 0xe3},
+    {0x61, 0x304, 0x101}, {0x61, 0x306, 0x103}, {0x61, 0x307, 0x227}, {0x61, 0x308, 0xe4},
+    {0x61, 0x309, 0x1ea3}, {0x61, 0x30a, 0xe5}, {0x61, 0x30c, 0x1ce}, {0x61, 0x30f, 0x201},
+    {0x61, 0x311, 0x203}, {0x61, 0x323, 0x1ea1}, {0x61, 0x325, 0x1e01}, {0x61, 0x328, 0x105},
+    {0x62, 0x307, 0x1e03}, {0x62, 0x323, 0x1e05}, {0x62, 0x331, 0x1e07}, {0x63, 0x301, 0x107},
+    {0x63, 0x302, 0x109}, {0x63, 0x307, 0x10b}, {0x63, 0x30c, 0x10d}, {0x63, 0x327, 0xe7},
+    {0x64, 0x307, 0x1e0b}, {0x64, 0x30c, 0x10f}, {0x64, 0x323, 0x1e0d}, {0x64, 0x327, 0x1e11},
+    {0x64, 0x32d, 0x1e13}, {0x64, 0x331, 0x1e0f}, {0x65, 0x300, 0xe8}, {0x65, 0x301, 0xe9},
+    {0x65, 0x302, 0xea}, {0x65, 0x303, 0x1ebd}, {0x65, 0x304, 0x113}, {0x65, 0x306, 0x115},
+    {0x65, 0x307, 0x117}, {0x65, 0x308, 0xeb}, {0x65, 0x309, 0x1ebb}, {0x65, 0x30c, 0x11b},
+    {0x65, 0x30f, 0x205}, {0x65, 0x311, 0x207}, {0x65, 0x323, 0x1eb9}, {0x65, 0x327, 0x229},
+    {0x65, 0x328, 0x119}, {0x65, 0x32d, 0x1e19}, {0x65, 0x330, 0x1e1b}, {0x66, 0x307, 0x1e1f},
+    {0x67, 0x301, 0x1f5}, {0x67, 0x302, 0x11d}, {0x67, 0x304, 0x1e21}, {0x67, 0x306, 0x11f},
+    {0x67, 0x307, 0x121}, {0x67, 0x30c, 0x1e7}, {0x67, 0x327, 0x123}, {0x68, 0x302, 0x125},
+    {0x68, 0x307, 0x1e23}, {0x68, 0x308, 0x1e27}, {0x68, 0x30c, 0x21f}, {0x68, 0x323, 0x1e25},
+    {0x68, 0x327, 0x1e29}, {0x68, 0x32e, 0x1e2b}, {0x68, 0x331, 0x1e96}, {0x69, 0x300, 0xec},
+    {0x69, 0x301, 0xed}, {0x69, 0x302, 0xee}, {0x69, 0x303, 0x129}, {0x69, 0x304, 0x12b},
+    {0x69, 0x306, 0x12d}, {0x69, 0x308, 0xef}, {0x69, 0x309, 0x1ec9}, {0x69, 0x30c, 0x1d0},
+    {0x69, 0x30f, 0x209}, {0x69, 0x311, 0x20b}, {0x69, 0x323, 0x1ecb}, {0x69, 0x328, 0x12f},
+    {0x69, 0x330, 0x1e2d}, {0x6a, 0x302, 0x135}, {0x6a, 0x30c, 0x1f0}, {0x6b, 0x301, 0x1e31},
+    {0x6b, 0x30c, 0x1e9}, {0x6b, 0x323, 0x1e33}, {0x6b, 0x327, 0x137}, {0x6b, 0x331, 0x1e35},
+    {0x6c, 0x301, 0x13a}, {0x6c, 0x30c, 0x13e}, {0x6c, 0x323, 0x1e37}, {0x6c, 0x327, 0x13c},
+    {0x6c, 0x32d, 0x1e3d}, {0x6c, 0x331, 0x1e3b}, {0x6d, 0x301, 0x1e3f}, {0x6d, 0x307, 0x1e41},
+    {0x6d, 0x323, 0x1e43}, {0x6e, 0x300, 0x1f9}, {0x6e, 0x301, 0x144}, {0x6e, 0x303, 0xf1},
+    {0x6e, 0x307, 0x1e45}, {0x6e, 0x30c, 0x148}, {0x6e, 0x323, 0x1e47}, {0x6e, 0x327, 0x146},
+    {0x6e, 0x32d, 0x1e4b}, {0x6e, 0x331, 0x1e49}, {0x6f, 0x300, 0xf2}, {0x6f, 0x301, 0xf3},
+    {0x6f, 0x302, 0xf4}, {0x6f, 0x303, 0xf5}, {0x6f, 0x304, 0x14d}, {0x6f, 0x306, 0x14f},
+    {0x6f, 0x307, 0x22f}, {0x6f, 0x308, 0xf6}, {0x6f, 0x309, 0x1ecf}, {0x6f, 0x30b, 0x151},
+    {0x6f, 0x30c, 0x1d2}, {0x6f, 0x30f, 0x20d}, {0x6f, 0x311, 0x20f}, {0x6f, 0x31b, 0x1a1},
+    {0x6f, 0x323, 0x1ecd}, {0x6f, 0x328, 0x1eb}, {0x70, 0x301, 0x1e55}, {0x70, 0x307, 0x1e57},
+    {0x72, 0x301, 0x155}, {0x72, 0x307, 0x1e59}, {0x72, 0x30c, 0x159}, {0x72, 0x30f, 0x211},
+    {0x72, 0x311, 0x213}, {0x72, 0x323, 0x1e5b}, {0x72, 0x327, 0x157}, {0x72, 0x331, 0x1e5f},
+    {0x73, 0x301, 0x15b}, {0x73, 0x302, 0x15d}, {0x73, 0x307, 0x1e61}, {0x73, 0x30c, 0x161},
+    {0x73, 0x323, 0x1e63}, {0x73, 0x326, 0x219}, {0x73, 0x327, 0x15f}, {0x74, 0x307, 0x1e6b},
+    {0x74, 0x308, 0x1e97}, {0x74, 0x30c, 0x165}, {0x74, 0x323, 0x1e6d}, {0x74, 0x326, 0x21b},
+    {0x74, 0x327, 0x163}, {0x74, 0x32d, 0x1e71}, {0x74, 0x331, 0x1e6f}, {0x75, 0x300, 0xf9},
+    {0x75, 0x301, 0xfa}, {0x75, 0x302, 0xfb}, {0x75, 0x303, 0x169}, {0x75, 0x304, 0x16b},
+    {0x75, 0x306, 0x16d}, {0x75, 0x308, 0xfc}, {0x75, 0x309, 0x1ee7}, {0x75, 0x30a, 0x16f},
+    {0x75, 0x30b, 0x171}, {0x75, 0x30c, 0x1d4}, {0x75, 0x30f, 0x215}, {0x75, 0x311, 0x217},
+    {0x75, 0x31b, 0x1b0}, {0x75, 0x323, 0x1ee5}, {0x75, 0x324, 0x1e73}, {0x75, 0x328, 0x173},
+    {0x75, 0x32d, 0x1e77}, {0x75, 0x330, 0x1e75}, {0x76, 0x303, 0x1e7d}, {0x76, 0x323, 0x1e7f},
+    {0x77, 0x300, 0x1e81}, {0x77, 0x301, 0x1e83}, {0x77, 0x302, 0x175}, {0x77, 0x307, 0x1e87},
+    {0x77, 0x308, 0x1e85}, {0x77, 0x30a, 0x1e98}, {0x77, 0x323, 0x1e89}, {0x78, 0x307, 0x1e8b},
+    {0x78, 0x308, 0x1e8d}, {0x79, 0x300, 0x1ef3}, {0x79, 0x301, 0xfd}, {0x79, 0x302, 0x177},
+    {0x79, 0x303, 0x1ef9}, {0x79, 0x304, 0x233}, {0x79, 0x307, 0x1e8f}, {0x79, 0x308, 0xff},
+    {0x79, 0x309, 0x1ef7}, {0x79, 0x30a, 0x1e99}, {0x79, 0x323, 0x1ef5}, {0x7a, 0x301, 0x17a},
+    {0x7a, 0x302, 0x1e91}, {0x7a, 0x307, 0x17c}, {0x7a, 0x30c, 0x17e}, {0x7a, 0x323, 0x1e93},
+    {0x7a, 0x331, 0x1e95}, {0xa8, 0x300, 0x1fed}, {0xa8, 0x301, 0x385}, {0xa8, 0x342, 0x1fc1},
+    {0xc2, 0x300, 0x1ea6}, {0xc2, 0x301, 0x1ea4}, {0xc2, 0x303, 0x1eaa}, {0xc2, 0x309, 0x1ea8},
+    {0xc4, 0x304, 0x1de}, {0xc5, 0x301, 0x1fa}, {0xc6, 0x301, 0x1fc}, {0xc6, 0x304, 0x1e2},
+    {0xc7, 0x301, 0x1e08}, {0xca, 0x300, 0x1ec0}, {0xca, 0x301, 0x1ebe}, {0xca, 0x303, 0x1ec4},
+    {0xca, 0x309, 0x1ec2}, {0xcf, 0x301, 0x1e2e}, {0xd4, 0x300, 0x1ed2}, {0xd4, 0x301, 0x1ed0},
+    {0xd4, 0x303, 0x1ed6}, {0xd4, 0x309, 0x1ed4}, {0xd5, 0x301, 0x1e4c}, {0xd5, 0x304, 0x22c},
+    {0xd5, 0x308, 0x1e4e}, {0xd6, 0x304, 0x22a}, {0xd8, 0x301, 0x1fe}, {0xdc, 0x300, 0x1db},
+    {0xdc, 0x301, 0x1d7}, {0xdc, 0x304, 0x1d5}, {0xdc, 0x30c, 0x1d9}, {0xe2, 0x300, 0x1ea7},
+    {0xe2, 0x301, 0x1ea5}, {0xe2, 0x303, 0x1eab}, {0xe2, 0x309, 0x1ea9}, {0xe4, 0x304, 0x1df},
+    {0xe5, 0x301, 0x1fb}, {0xe6, 0x301, 0x1fd}, {0xe6, 0x304, 0x1e3}, {0xe7, 0x301, 0x1e09},
+    {0xea, 0x300, 0x1ec1}, {0xea, 0x301, 0x1ebf}, {0xea, 0x303, 0x1ec5}, {0xea, 0x309, 0x1ec3},
+    {0xef, 0x301, 0x1e2f}, {0xf4, 0x300, 0x1ed3}, {0xf4, 0x301, 0x1ed1}, {0xf4, 0x303, 0x1ed7},
+    {0xf4, 0x309, 0x1ed5}, {0xf5, 0x301, 0x1e4d}, {0xf5, 0x304, 0x22d}, {0xf5, 0x308, 0x1e4f},
+    {0xf6, 0x304, 0x22b}, {0xf8, 0x301, 0x1ff}, {0xfc, 0x300, 0x1dc}, {0xfc, 0x301, 0x1d8},
+    {0xfc, 0x304, 0x1d6}, {0xfc, 0x30c, 0x1da}, {0x102, 0x300, 0x1eb0}, {0x102, 0x301, 0x1eae},
+    {0x102, 0x303, 0x1eb4}, {0x102, 0x309, 0x1eb2}, {0x103, 0x300, 0x1eb1}, {0x103, 0x301, 0x1eaf},
+    {0x103, 0x303, 0x1eb5}, {0x103, 0x309, 0x1eb3}, {0x112, 0x300, 0x1e14}, {0x112, 0x301, 0x1e16},
+    {0x113, 0x300, 0x1e15}, {0x113, 0x301, 0x1e17}, {0x14c, 0x300, 0x1e50}, {0x14c, 0x301, 0x1e52},
+    {0x14d, 0x300, 0x1e51}, {0x14d, 0x301, 0x1e53}, {0x15a, 0x307, 0x1e64}, {0x15b, 0x307, 0x1e65},
+    {0x160, 0x307, 0x1e66}, {0x161, 0x307, 0x1e67}, {0x168, 0x301, 0x1e78}, {0x169, 0x301, 0x1e79},
+    {0x16a, 0x308, 0x1e7a}, {0x16b, 0x308, 0x1e7b}, {0x17f, 0x307, 0x1e9b}, {0x1a0, 0x300, 0x1edc},
+    {0x1a0, 0x301, 0x1eda}, {0x1a0, 0x303, 0x1ee0}, {0x1a0, 0x309, 0x1ede}, {0x1a0, 0x323, 0x1ee2},
+    {0x1a1, 0x300, 0x1edd}, {0x1a1, 0x301, 0x1edb}, {0x1a1, 0x303, 0x1ee1}, {0x1a1, 0x309, 0x1edf},
+    {0x1a1, 0x323, 0x1ee3}, {0x1af, 0x300, 0x1eea}, {0x1af, 0x301, 0x1ee8}, {0x1af, 0x303, 0x1eee},
+    {0x1af, 0x309, 0x1eec}, {0x1af, 0x323, 0x1ef0}, {0x1b0, 0x300, 0x1eeb}, {0x1b0, 0x301, 0x1ee9},
+    {0x1b0, 0x303, 0x1eef}, {0x1b0, 0x309, 0x1eed}, {0x1b0, 0x323, 0x1ef1}, {0x1b7, 0x30c, 0x1ee},
+    {0x1ea, 0x304, 0x1ec}, {0x1eb, 0x304, 0x1ed}, {0x226, 0x304, 0x1e0}, {0x227, 0x304, 0x1e1},
+    {0x228, 0x306, 0x1e1c}, {0x229, 0x306, 0x1e1d}, {0x22e, 0x304, 0x230}, {0x22f, 0x304, 0x231},
+    {0x292, 0x30c, 0x1ef}, {0x391, 0x300, 0x1fba}, {0x391, 0x301, 0x386}, {0x391, 0x304, 0x1fb9},
+    {0x391, 0x306, 0x1fb8}, {0x391, 0x313, 0x1f08}, {0x391, 0x314, 0x1f09}, {0x391, 0x345, 0x1fbc},
+    {0x395, 0x300, 0x1fc8}, {0x395, 0x301, 0x388}, {0x395, 0x313, 0x1f18}, {0x395, 0x314, 0x1f19},
+    {0x397, 0x300, 0x1fca}, {0x397, 0x301, 0x389}, {0x397, 0x313, 0x1f28}, {0x397, 0x314, 0x1f29},
+    {0x397, 0x345, 0x1fcc}, {0x399, 0x300, 0x1fda}, {0x399, 0x301, 0x38a}, {0x399, 0x304, 0x1fd9},
+    {0x399, 0x306, 0x1fd8}, {0x399, 0x308, 0x3aa}, {0x399, 0x313, 0x1f38}, {0x399, 0x314, 0x1f39},
+    {0x39f, 0x300, 0x1ff8}, {0x39f, 0x301, 0x38c}, {0x39f, 0x313, 0x1f48}, {0x39f, 0x314, 0x1f49},
+    {0x3a1, 0x314, 0x1fec}, {0x3a5, 0x300, 0x1fea}, {0x3a5, 0x301, 0x38e}, {0x3a5, 0x304, 0x1fe9},
+    {0x3a5, 0x306, 0x1fe8}, {0x3a5, 0x308, 0x3ab}, {0x3a5, 0x314, 0x1f59}, {0x3a9, 0x300, 0x1ffa},
+    {0x3a9, 0x301, 0x38f}, {0x3a9, 0x313, 0x1f68}, {0x3a9, 0x314, 0x1f69}, {0x3a9, 0x345, 0x1ffc},
+    {0x3ac, 0x345, 0x1fb4}, {0x3ae, 0x345, 0x1fc4}, {0x3b1, 0x300, 0x1f70}, {0x3b1, 0x301, 0x3ac},
+    {0x3b1, 0x304, 0x1fb1}, {0x3b1, 0x306, 0x1fb0}, {0x3b1, 0x313, 0x1f00}, {0x3b1, 0x314, 0x1f01},
+    {0x3b1, 0x342, 0x1fb6}, {0x3b1, 0x345, 0x1fb3}, {0x3b5, 0x300, 0x1f72}, {0x3b5, 0x301, 0x3ad},
+    {0x3b5, 0x313, 0x1f10}, {0x3b5, 0x314, 0x1f11}, {0x3b7, 0x300, 0x1f74}, {0x3b7, 0x301, 0x3ae},
+    {0x3b7, 0x313, 0x1f20}, {0x3b7, 0x314, 0x1f21}, {0x3b7, 0x342, 0x1fc6}, {0x3b7, 0x345, 0x1fc3},
+    {0x3b9, 0x300, 0x1f76}, {0x3b9, 0x301, 0x3af}, {0x3b9, 0x304, 0x1fd1}, {0x3b9, 0x306, 0x1fd0},
+    {0x3b9, 0x308, 0x3ca}, {0x3b9, 0x313, 0x1f30}, {0x3b9, 0x314, 0x1f31}, {0x3b9, 0x342, 0x1fd6},
+    {0x3bf, 0x300, 0x1f78}, {0x3bf, 0x301, 0x3cc}, {0x3bf, 0x313, 0x1f40}, {0x3bf, 0x314, 0x1f41},
+    {0x3c1, 0x313, 0x1fe4}, {0x3c1, 0x314, 0x1fe5}, {0x3c5, 0x300, 0x1f7a}, {0x3c5, 0x301, 0x3cd},
+    {0x3c5, 0x304, 0x1fe1}, {0x3c5, 0x306, 0x1fe0}, {0x3c5, 0x308, 0x3cb}, {0x3c5, 0x313, 0x1f50},
+    {0x3c5, 0x314, 0x1f51}, {0x3c5, 0x342, 0x1fe6}, {0x3c9, 0x300, 0x1f7c}, {0x3c9, 0x301, 0x3ce},
+    {0x3c9, 0x313, 0x1f60}, {0x3c9, 0x314, 0x1f61}, {0x3c9, 0x342, 0x1ff6}, {0x3c9, 0x345, 0x1ff3},
+    {0x3ca, 0x300, 0x1fd2}, {0x3ca, 0x301, 0x390}, {0x3ca, 0x342, 0x1fd7}, {0x3cb, 0x300, 0x1fe2},
+    {0x3cb, 0x301, 0x3b0}, {0x3cb, 0x342, 0x1fe7}, {0x3ce, 0x345, 0x1ff4}, {0x3d2, 0x301, 0x3d3},
+    {0x3d2, 0x308, 0x3d4}, {0x406, 0x308, 0x407}, {0x410, 0x306, 0x4d0}, {0x410, 0x308, 0x4d2},
+    {0x413, 0x301, 0x403}, {0x415, 0x300, 0x400}, {0x415, 0x306, 0x4d6}, {0x415, 0x308, 0x401},
+    {0x416, 0x306, 0x4c1}, {0x416, 0x308, 0x4dc}, {0x417, 0x308, 0x4de}, {0x418, 0x300, 0x40d},
+    {0x418, 0x304, 0x4e2}, {0x418, 0x306, 0x419}, {0x418, 0x308, 0x4e4}, {0x41a, 0x301, 0x40c},
+    {0x41e, 0x308, 0x4e6}, {0x423, 0x304, 0x4ee}, {0x423, 0x306, 0x40e}, {0x423, 0x308, 0x4f0},
+    {0x423, 0x30b, 0x4f2}, {0x427, 0x308, 0x4f4}, {0x42b, 0x308, 0x4f8}, {0x42d, 0x308, 0x4ec},
+    {0x430, 0x306, 0x4d1}, {0x430, 0x308, 0x4d3}, {0x433, 0x301, 0x453}, {0x435, 0x300, 0x450},
+    {0x435, 0x306, 0x4d7}, {0x435, 0x308, 0x451}, {0x436, 0x306, 0x4c2}, {0x436, 0x308, 0x4dd},
+    {0x437, 0x308, 0x4df}, {0x438, 0x300, 0x45d}, {0x438, 0x304, 0x4e3}, {0x438, 0x306, 0x439},
+    {0x438, 0x308, 0x4e5}, {0x43a, 0x301, 0x45c}, {0x43e, 0x308, 0x4e7}, {0x443, 0x304, 0x4ef},
+    {0x443, 0x306, 0x45e}, {0x443, 0x308, 0x4f1}, {0x443, 0x30b, 0x4f3}, {0x447, 0x308, 0x4f5},
+    {0x44b, 0x308, 0x4f9}, {0x44d, 0x308, 0x4ed}, {0x456, 0x308, 0x457}, {0x474, 0x30f, 0x476},
+    {0x475, 0x30f, 0x477}, {0x4d8, 0x308, 0x4da}, {0x4d9, 0x308, 0x4db}, {0x4e8, 0x308, 0x4ea},
+    {0x4e9, 0x308, 0x4eb}, {0x627, 0x653, 0x622}, {0x627, 0x654, 0x623}, {0x627, 0x655, 0x625},
+    {0x648, 0x654, 0x624}, {0x64a, 0x654, 0x626}, {0x6c1, 0x654, 0x6c2}, {0x6d2, 0x654, 0x6d3},
+    {0x6d5, 0x654, 0x6c0}, {0x928, 0x93c, 0x929}, {0x930, 0x93c, 0x931}, {0x933, 0x93c, 0x934},
+    {0x9c7, 0x9be, 0x9cb}, {0x9c7, 0x9d7, 0x9cc}, {0xb47, 0xb3e, 0xb4b}, {0xb47, 0xb56, 0xb48},
+    {0xb47, 0xb57, 0xb4c}, {0xb92, 0xbd7, 0xb94}, {0xbc6, 0xbbe, 0xbca}, {0xbc6, 0xbd7, 0xbcc},
+    {0xbc7, 0xbbe, 0xbcb}, {0xc46, 0xc56, 0xc48}, {0xcbf, 0xcd5, 0xcc0}, {0xcc6, 0xcc2, 0xcca},
+    {0xcc6, 0xcd5, 0xcc7}, {0xcc6, 0xcd6, 0xcc8}, {0xcca, 0xcd5, 0xccb}, {0xd46, 0xd3e, 0xd4a},
+    {0xd46, 0xd57, 0xd4c}, {0xd47, 0xd3e, 0xd4b}, {0xdd9, 0xdca, 0xdda}, {0xdd9, 0xdcf, 0xddc},
+    {0xdd9, 0xddf, 0xdde}, {0xddc, 0xdca, 0xddd}, {0x1025, 0x102e, 0x1026}, {0x1b05, 0x1b35, 0x1b06},
+    {0x1b07, 0x1b35, 0x1b08}, {0x1b09, 0x1b35, 0x1b0a}, {0x1b0b, 0x1b35, 0x1b0c}, {0x1b0d, 0x1b35, 0x1b0e},
+    {0x1b11, 0x1b35, 0x1b12}, {0x1b3a, 0x1b35, 0x1b3b}, {0x1b3c, 0x1b35, 0x1b3d}, {0x1b3e, 0x1b35, 0x1b40},
+    {0x1b3f, 0x1b35, 0x1b41}, {0x1b42, 0x1b35, 0x1b43}, {0x1e36, 0x304, 0x1e38}, {0x1e37, 0x304, 0x1e39},
+    {0x1e5a, 0x304, 0x1e5c}, {0x1e5b, 0x304, 0x1e5d}, {0x1e62, 0x307, 0x1e68}, {0x1e63, 0x307, 0x1e69},
+    {0x1ea0, 0x302, 0x1eac}, {0x1ea0, 0x306, 0x1eb6}, {0x1ea1, 0x302, 0x1ead}, {0x1ea1, 0x306, 0x1eb7},
+    {0x1eb8, 0x302, 0x1ec6}, {0x1eb9, 0x302, 0x1ec7}, {0x1ecc, 0x302, 0x1ed8}, {0x1ecd, 0x302, 0x1ed9},
+    {0x1f00, 0x300, 0x1f02}, {0x1f00, 0x301, 0x1f04}, {0x1f00, 0x342, 0x1f06}, {0x1f00, 0x345, 0x1f80},
+    {0x1f01, 0x300, 0x1f03}, {0x1f01, 0x301, 0x1f05}, {0x1f01, 0x342, 0x1f07}, {0x1f01, 0x345, 0x1f81},
+    {0x1f02, 0x345, 0x1f82}, {0x1f03, 0x345, 0x1f83}, {0x1f04, 0x345, 0x1f84}, {0x1f05, 0x345, 0x1f85},
+    {0x1f06, 0x345, 0x1f86}, {0x1f07, 0x345, 0x1f87}, {0x1f08, 0x300, 0x1f0a}, {0x1f08, 0x301, 0x1f0c},
+    {0x1f08, 0x342, 0x1f0e}, {0x1f08, 0x345, 0x1f88}, {0x1f09, 0x300, 0x1f0b}, {0x1f09, 0x301, 0x1f0d},
+    {0x1f09, 0x342, 0x1f0f}, {0x1f09, 0x345, 0x1f89}, {0x1f0a, 0x345, 0x1f8a}, {0x1f0b, 0x345, 0x1f8b},
+    {0x1f0c, 0x345, 0x1f8c}, {0x1f0d, 0x345, 0x1f8d}, {0x1f0e, 0x345, 0x1f8e}, {0x1f0f, 0x345, 0x1f8f},
+    {0x1f10, 0x300, 0x1f12}, {0x1f10, 0x301, 0x1f14}, {0x1f11, 0x300, 0x1f13}, {0x1f11, 0x301, 0x1f15},
+    {0x1f18, 0x300, 0x1f1a}, {0x1f18, 0x301, 0x1f1c}, {0x1f19, 0x300, 0x1f1b}, {0x1f19, 0x301, 0x1f1d},
+    {0x1f20, 0x300, 0x1f22}, {0x1f20, 0x301, 0x1f24}, {0x1f20, 0x342, 0x1f26}, {0x1f20, 0x345, 0x1f90},
+    {0x1f21, 0x300, 0x1f23}, {0x1f21, 0x301, 0x1f25}, {0x1f21, 0x342, 0x1f27}, {0x1f21, 0x345, 0x1f91},
+    {0x1f22, 0x345, 0x1f92}, {0x1f23, 0x345, 0x1f93}, {0x1f24, 0x345, 0x1f94}, {0x1f25, 0x345, 0x1f95},
+    {0x1f26, 0x345, 0x1f96}, {0x1f27, 0x345, 0x1f97}, {0x1f28, 0x300, 0x1f2a}, {0x1f28, 0x301, 0x1f2c},
+    {0x1f28, 0x342, 0x1f2e}, {0x1f28, 0x345, 0x1f98}, {0x1f29, 0x300, 0x1f2b}, {0x1f29, 0x301, 0x1f2d},
+    {0x1f29, 0x342, 0x1f2f}, {0x1f29, 0x345, 0x1f99}, {0x1f2a, 0x345, 0x1f9a}, {0x1f2b, 0x345, 0x1f9b},
+    {0x1f2c, 0x345, 0x1f9c}, {0x1f2d, 0x345, 0x1f9d}, {0x1f2e, 0x345, 0x1f9e}, {0x1f2f, 0x345, 0x1f9f},
+    {0x1f30, 0x300, 0x1f32}, {0x1f30, 0x301, 0x1f34}, {0x1f30, 0x342, 0x1f36}, {0x1f31, 0x300, 0x1f33},
+    {0x1f31, 0x301, 0x1f35}, {0x1f31, 0x342, 0x1f37}, {0x1f38, 0x300, 0x1f3a}, {0x1f38, 0x301, 0x1f3c},
+    {0x1f38, 0x342, 0x1f3e}, {0x1f39, 0x300, 0x1f3b}, {0x1f39, 0x301, 0x1f3d}, {0x1f39, 0x342, 0x1f3f},
+    {0x1f40, 0x300, 0x1f42}, {0x1f40, 0x301, 0x1f44}, {0x1f41, 0x300, 0x1f43}, {0x1f41, 0x301, 0x1f45},
+    {0x1f48, 0x300, 0x1f4a}, {0x1f48, 0x301, 0x1f4c}, {0x1f49, 0x300, 0x1f4b}, {0x1f49, 0x301, 0x1f4d},
+    {0x1f50, 0x300, 0x1f52}, {0x1f50, 0x301, 0x1f54}, {0x1f50, 0x342, 0x1f56}, {0x1f51, 0x300, 0x1f53},
+    {0x1f51, 0x301, 0x1f55}, {0x1f51, 0x342, 0x1f57}, {0x1f59, 0x300, 0x1f5b}, {0x1f59, 0x301, 0x1f5d},
+    {0x1f59, 0x342, 0x1f5f}, {0x1f60, 0x300, 0x1f62}, {0x1f60, 0x301, 0x1f64}, {0x1f60, 0x342, 0x1f66},
+    {0x1f60, 0x345, 0x1fa0}, {0x1f61, 0x300, 0x1f63}, {0x1f61, 0x301, 0x1f65}, {0x1f61, 0x342, 0x1f67},
+    {0x1f61, 0x345, 0x1fa1}, {0x1f62, 0x345, 0x1fa2}, {0x1f63, 0x345, 0x1fa3}, {0x1f64, 0x345, 0x1fa4},
+    {0x1f65, 0x345, 0x1fa5}, {0x1f66, 0x345, 0x1fa6}, {0x1f67, 0x345, 0x1fa7}, {0x1f68, 0x300, 0x1f6a},
+    {0x1f68, 0x301, 0x1f6c}, {0x1f68, 0x342, 0x1f6e}, {0x1f68, 0x345, 0x1fa8}, {0x1f69, 0x300, 0x1f6b},
+    {0x1f69, 0x301, 0x1f6d}, {0x1f69, 0x342, 0x1f6f}, {0x1f69, 0x345, 0x1fa9}, {0x1f6a, 0x345, 0x1faa},
+    {0x1f6b, 0x345, 0x1fab}, {0x1f6c, 0x345, 0x1fac}, {0x1f6d, 0x345, 0x1fad}, {0x1f6e, 0x345, 0x1fae},
+    {0x1f6f, 0x345, 0x1faf}, {0x1f70, 0x345, 0x1fb2}, {0x1f74, 0x345, 0x1fc2}, {0x1f7c, 0x345, 0x1ff2},
+    {0x1fb6, 0x345, 0x1fb7}, {0x1fbf, 0x300, 0x1fcd}, {0x1fbf, 0x301, 0x1fce}, {0x1fbf, 0x342, 0x1fcf},
+    {0x1fc6, 0x345, 0x1fc7}, {0x1ff6, 0x345, 0x1ff7}, {0x1ffe, 0x300, 0x1fdd}, {0x1ffe, 0x301, 0x1fde},
+    {0x1ffe, 0x342, 0x1fdf}, {0x2190, 0x338, 0x219a}, {0x2192, 0x338, 0x219b}, {0x2194, 0x338, 0x21ae},
+    {0x21d0, 0x338, 0x21cd}, {0x21d2, 0x338, 0x21cf}, {0x21d4, 0x338, 0x21ce}, {0x2203, 0x338, 0x2204},
+    {0x2208, 0x338, 0x2209}, {0x220b, 0x338, 0x220c}, {0x2223, 0x338, 0x2224}, {0x2225, 0x338, 0x2226},
+    {0x223c, 0x338, 0x2241}, {0x2243, 0x338, 0x2244}, {0x2245, 0x338, 0x2247}, {0x2248, 0x338, 0x2249},
+    {0x224d, 0x338, 0x226d}, {0x2261, 0x338, 0x2262}, {0x2264, 0x338, 0x2270}, {0x2265, 0x338, 0x2271},
+    {0x2272, 0x338, 0x2274}, {0x2273, 0x338, 0x2275}, {0x2276, 0x338, 0x2278}, {0x2277, 0x338, 0x2279},
+    {0x227a, 0x338, 0x2280}, {0x227b, 0x338, 0x2281}, {0x227c, 0x338, 0x22e0}, {0x227d, 0x338, 0x22e1},
+    {0x2282, 0x338, 0x2284}, {0x2283, 0x338, 0x2285}, {0x2286, 0x338, 0x2288}, {0x2287, 0x338, 0x2289},
+    {0x2291, 0x338, 0x22e2}, {0x2292, 0x338, 0x22e3}, {0x22a2, 0x338, 0x22ac}, {0x22a8, 0x338, 0x22ad},
+    {0x22a9, 0x338, 0x22ae}, {0x22ab, 0x338, 0x22af}, {0x22b2, 0x338, 0x22ea}, {0x22b3, 0x338, 0x22eb},
+    {0x22b4, 0x338, 0x22ec}, {0x22b5, 0x338, 0x22ed}, {0x3046, 0x3099, 0x3094}, {0x304b, 0x3099, 0x304c},
+    {0x304d, 0x3099, 0x304e}, {0x304f, 0x3099, 0x3050}, {0x3051, 0x3099, 0x3052}, {0x3053, 0x3099, 0x3054},
+    {0x3055, 0x3099, 0x3056}, {0x3057, 0x3099, 0x3058}, {0x3059, 0x3099, 0x305a}, {0x305b, 0x3099, 0x305c},
+    {0x305d, 0x3099, 0x305e}, {0x305f, 0x3099, 0x3060}, {0x3061, 0x3099, 0x3062}, {0x3064, 0x3099, 0x3065},
+    {0x3066, 0x3099, 0x3067}, {0x3068, 0x3099, 0x3069}, {0x306f, 0x3099, 0x3070}, {0x306f, 0x309a, 0x3071},
+    {0x3072, 0x3099, 0x3073}, {0x3072, 0x309a, 0x3074}, {0x3075, 0x3099, 0x3076}, {0x3075, 0x309a, 0x3077},
+    {0x3078, 0x3099, 0x3079}, {0x3078, 0x309a, 0x307a}, {0x307b, 0x3099, 0x307c}, {0x307b, 0x309a, 0x307d},
+    {0x309d, 0x3099, 0x309e}, {0x30a6, 0x3099, 0x30f4}, {0x30ab, 0x3099, 0x30ac}, {0x30ad, 0x3099, 0x30ae},
+    {0x30af, 0x3099, 0x30b0}, {0x30b1, 0x3099, 0x30b2}, {0x30b3, 0x3099, 0x30b4}, {0x30b5, 0x3099, 0x30b6},
+    {0x30b7, 0x3099, 0x30b8}, {0x30b9, 0x3099, 0x30ba}, {0x30bb, 0x3099, 0x30bc}, {0x30bd, 0x3099, 0x30be},
+    {0x30bf, 0x3099, 0x30c0}, {0x30c1, 0x3099, 0x30c2}, {0x30c4, 0x3099, 0x30c5}, {0x30c6, 0x3099, 0x30c7},
+    {0x30c8, 0x3099, 0x30c9}, {0x30cf, 0x3099, 0x30d0}, {0x30cf, 0x309a, 0x30d1}, {0x30d2, 0x3099, 0x30d3},
+    {0x30d2, 0x309a, 0x30d4}, {0x30d5, 0x3099, 0x30d6}, {0x30d5, 0x309a, 0x30d7}, {0x30d8, 0x3099, 0x30d9},
+    {0x30d8, 0x309a, 0x30da}, {0x30db, 0x3099, 0x30dc}, {0x30db, 0x309a, 0x30dd}, {0x30ef, 0x3099, 0x30f7},
+    {0x30f0, 0x3099, 0x30f8}, {0x30f1, 0x3099, 0x30f9}, {0x30f2, 0x3099, 0x30fa}, {0x30fd, 0x3099, 0x30fe},
+    {0x11099, 0x110ba, 0x1109a}, {0x1109b, 0x110ba, 0x1109c}, {0x110a5, 0x110ba, 0x110ab}, {0x11131, 0x11127, 0x1112e},
+    {0x11132, 0x11127, 0x1112f}, {0x11347, 0x1133e, 0x1134b}, {0x11347, 0x11357, 0x1134c}, {0x114b9, 0x114b0, 0x114bc},
+    {0x114b9, 0x114ba, 0x114bb}, {0x114b9, 0x114bd, 0x114be}, {0x115b8, 0x115af, 0x115ba}, {0x115b9, 0x115af, 0x115bb},
+    {0x11935, 0x11930, 0x11938},
+};
+
+/*
+ *  full case folding, looked up the same way as the normalization properties:
+ *      record = unicode_fold_records[unicode_fold_stage2[(unicode_fold_stage1[cp >> UNICODE_FOLD_SHIFT] << UNICODE_FOLD_SHIFT) + (cp & UNICODE_FOLD_MASK)]]
+ *  code points from UNICODE_FOLD_LIMIT on all use record 0 (they fold to themselves)
+ *
+ *  a simple fold adds delta to the code point, a fold to more than one character has an index into
+ *  unicode_fold_expansions (the length followed by the code points) in expansion
+ */
+#define UNICODE_FOLD_SHIFT 6
+#define UNICODE_FOLD_MASK 63
+#define UNICODE_FOLD_LIMIT 0x1e940
+#define UNICODE_FOLD_MAX_EXPANSION 3
+
+struct unicode_fold_record
+{
+    int32_t delta;
+    uint16_t expansion;
+};
+
+static const uint8_t unicode_fold_stage1[1957] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 0, 0, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 20, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 24, 24, 25, 24, 26, 27, 28, 29,
+    0, 0, 0, 0, 30, 31, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 36, 24, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 39, 0, 40, 41, 42, 43,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 49, 50, 0, 51, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 56,
+};
+
+static const uint8_t unicode_fold_stage2[3648] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 5, 0, 4, 0, 4, 0, 4, 0, 0, 4, 0, 4, 0, 4, 0, 4,
+    0, 4, 0, 4, 0, 4, 0, 4, 0, 6, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 7, 4, 0, 4, 0, 4, 0, 8,
+    0, 9, 4, 0, 4, 0, 10, 4, 0, 11, 11, 4, 0, 0, 12, 13, 14, 4, 0, 11, 15, 0, 16, 17, 4, 0, 0, 0, 16, 18, 0, 19,
+    4, 0, 4, 0, 4, 0, 20, 4, 0, 20, 0, 0, 4, 0, 20, 4, 0, 21, 21, 4, 0, 4, 0, 22, 4, 0, 0, 0, 4, 0, 0, 0,
+    0, 0, 0, 0, 23, 4, 0, 23, 4, 0, 23, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 24, 23, 4, 0, 4, 0, 25, 26, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    27, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 28, 4, 0, 29, 30, 0,
+    0, 4, 0, 31, 32, 33, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 34,
+    0, 0, 0, 0, 0, 0, 35, 0, 36, 36, 36, 0, 37, 0, 38, 38, 39, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 42, 43, 0, 0, 0, 44, 45, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 46, 47, 0, 0, 48, 49, 0, 4, 0, 50, 4, 0, 0, 27, 27, 27,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    52, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 0, 55, 0, 0, 0, 0, 0, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 0, 0,
+    57, 58, 59, 60, 60, 61, 62, 63, 64, 0, 0, 0, 0, 0, 0, 0, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 0, 0, 65, 65, 65,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 66, 67, 68, 69, 70, 71, 0, 0, 3, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56,
+    0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 0, 0, 72, 0, 73, 0, 74, 0, 75, 0, 0, 56, 0, 56, 0, 56, 0, 56,
+    0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    76, 77, 78, 79, 80, 81, 82, 83, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 84, 85, 86, 87, 88, 89, 90, 91,
+    92, 93, 94, 95, 96, 97, 98, 99, 92, 93, 94, 95, 96, 97, 98, 99, 0, 0, 100, 101, 102, 0, 103, 104, 56, 56, 105, 105, 101, 0, 106, 0,
+    0, 0, 107, 108, 109, 0, 110, 111, 112, 112, 112, 112, 108, 0, 0, 0, 0, 0, 113, 39, 0, 0, 114, 115, 56, 56, 116, 116, 0, 0, 0, 0,
+    0, 0, 117, 40, 118, 0, 119, 120, 56, 56, 121, 121, 50, 0, 0, 0, 0, 0, 122, 123, 124, 0, 125, 126, 127, 127, 128, 128, 123, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 130, 131, 0, 0, 0, 0, 0, 0, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+    134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 135, 136, 137, 0, 0, 4, 0, 4, 0, 4, 0, 138, 139, 140, 141, 0, 4, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 142, 142,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 143, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 4, 0, 144, 0, 0, 4, 0, 4, 0, 0, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 145, 146, 147, 148, 145, 0, 149, 150, 151, 152, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 47, 153, 154, 4, 0, 4, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+    155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+    155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+    156, 157, 158, 159, 160, 161, 161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 163, 164, 165, 166, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+    167, 167, 167, 167, 167, 167, 167, 167, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+    167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 0, 168, 168, 168, 168,
+    168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 0, 168, 168, 168, 168, 168, 168, 168, 0, 168, 168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const struct unicode_fold_record unicode_fold_records[170] = {
+    {0, 0}, {32, 0}, {775, 0}, {0, 1}, {1, 0}, {0, 4}, {0, 7}, {-121, 0},
+    {-268, 0}, {210, 0}, {206, 0}, {205, 0}, {79, 0}, {202, 0}, {203, 0}, {207, 0},
+    {211, 0}, {209, 0}, {213, 0}, {214, 0}, {218, 0}, {217, 0}, {219, 0}, {2, 0},
+    {0, 10}, {-97, 0}, {-56, 0}, {-130, 0}, {10795, 0}, {-163, 0}, {10792, 0}, {-195, 0},
+    {69, 0}, {71, 0}, {116, 0}, {38, 0}, {37, 0}, {64, 0}, {63, 0}, {0, 13},
+    {0, 17}, {8, 0}, {-30, 0}, {-25, 0}, {-15, 0}, {-22, 0}, {-54, 0}, {-48, 0},
+    {-60, 0}, {-64, 0}, {-7, 0}, {80, 0}, {15, 0}, {48, 0}, {0, 21}, {7264, 0},
+    {-8, 0}, {-6222, 0}, {-6221, 0}, {-6212, 0}, {-6210, 0}, {-6211, 0}, {-6204, 0}, {-6180, 0},
+    {35267, 0}, {-3008, 0}, {0, 24}, {0, 27}, {0, 30}, {0, 33}, {0, 36}, {-58, 0},
+    {0, 39}, {0, 42}, {0, 46}, {0, 50}, {0, 54}, {0, 57}, {0, 60}, {0, 63},
+    {0, 66}, {0, 69}, {0, 72}, {0, 75}, {0, 78}, {0, 81}, {0, 84}, {0, 87},
+    {0, 90}, {0, 93}, {0, 96}, {0, 99}, {0, 102}, {0, 105}, {0, 108}, {0, 111},
+    {0, 114}, {0, 117}, {0, 120}, {0, 123}, {0, 126}, {0, 129}, {0, 132}, {0, 135},
+    {0, 138}, {-74, 0}, {-7173, 0}, {0, 142}, {0, 145}, {0, 148}, {0, 151}, {0, 154},
+    {-86, 0}, {0, 158}, {0, 162}, {0, 165}, {-100, 0}, {0, 169}, {0, 173}, {0, 176},
+    {0, 179}, {-112, 0}, {0, 183}, {0, 186}, {0, 189}, {0, 192}, {0, 195}, {-128, 0},
+    {-126, 0}, {-7517, 0}, {-8383, 0}, {-8262, 0}, {28, 0}, {16, 0}, {26, 0}, {-10743, 0},
+    {-3814, 0}, {-10727, 0}, {-10780, 0}, {-10749, 0}, {-10783, 0}, {-10782, 0}, {-10815, 0}, {-35332, 0},
+    {-42280, 0}, {-42308, 0}, {-42319, 0}, {-42315, 0}, {-42305, 0}, {-42258, 0}, {-42282, 0}, {-42261, 0},
+    {928, 0}, {-42307, 0}, {-35384, 0}, {-38864, 0}, {0, 199}, {0, 202}, {0, 205}, {0, 208},
+    {0, 212}, {0, 216}, {0, 219}, {0, 222}, {0, 225}, {0, 228}, {0, 231}, {40, 0},
+    {39, 0}, {34, 0},
+};
+
+static const int32_t unicode_fold_expansions[234] = {
+    0x0, 0x2, 0x73, 0x73, 0x2, 0x69, 0x307, 0x2, 0x2bc, 0x6e, 0x2, 0x6a,
+    0x30c, 0x3, 0x3b9, 0x308, 0x301, 0x3, 0x3c5, 0x308, 0x301, 0x2, 0x565, 0x582,
+    0x2, 0x68, 0x331, 0x2, 0x74, 0x308, 0x2, 0x77, 0x30a, 0x2, 0x79, 0x30a,
+    0x2, 0x61, 0x2be, 0x2, 0x3c5, 0x313, 0x3, 0x3c5, 0x313, 0x300, 0x3, 0x3c5,
+    0x313, 0x301, 0x3, 0x3c5, 0x313, 0x342, 0x2, 0x1f00, 0x3b9, 0x2, 0x1f01, 0x3b9,
+    0x2, 0x1f02, 0x3b9, 0x2, 0x1f03, 0x3b9, 0x2, 0x1f04, 0x3b9, 0x2, 0x1f05, 0x3b9,
+    0x2, 0x1f06, 0x3b9, 0x2, 0x1f07, 0x3b9, 0x2, 0x1f20, 0x3b9, 0x2, 0x1f21, 0x3b9,
+    0x2, 0x1f22, 0x3b9, 0x2, 0x1f23, 0x3b9, 0x2, 0x1f24, 0x3b9, 0x2, 0x1f25, 0x3b9,
+    0x2, 0x1f26, 0x3b9, 0x2, 0x1f27, 0x3b9, 0x2, 0x1f60, 0x3b9, 0x2, 0x1f61, 0x3b9,
+    0x2, 0x1f62, 0x3b9, 0x2, 0x1f63, 0x3b9, 0x2, 0x1f64, 0x3b9, 0x2, 0x1f65, 0x3b9,
+    0x2, 0x1f66, 0x3b9, 0x2, 0x1f67, 0x3b9, 0x2, 0x1f70, 0x3b9, 0x2, 0x3b1, 0x3b9,
+    0x2, 0x3ac, 0x3b9, 0x2, 0x3b1, 0x342, 0x3, 0x3b1, 0x342, 0x3b9, 0x2, 0x1f74,
+    0x3b9, 0x2, 0x3b7, 0x3b9, 0x2, 0x3ae, 0x3b9, 0x2, 0x3b7, 0x342, 0x3, 0x3b7,
+    0x342, 0x3b9, 0x3, 0x3b9, 0x308, 0x300, 0x2, 0x3b9, 0x342, 0x3, 0x3b9, 0x308,
+    0x342, 0x3, 0x3c5, 0x308, 0x300, 0x2, 0x3c1, 0x313, 0x2, 0x3c5, 0x342, 0x3,
+    0x3c5, 0x308, 0x342, 0x2, 0x1f7c, 0x3b9, 0x2, 0x3c9, 0x3b9, 0x2, 0x3ce, 0x3b9,
+    0x2, 0x3c9, 0x342, 0x3, 0x3c9, 0x342, 0x3b9, 0x2, 0x66, 0x66, 0x2, 0x66,
+    0x69, 0x2, 0x66, 0x6c, 0x3, 0x66, 0x66, 0x69, 0x3, 0x66, 0x66, 0x6c,
+    0x2, 0x73, 0x74, 0x2, 0x574, 0x576, 0x2, 0x574, 0x565, 0x2, 0x574, 0x56b,
+    0x2, 0x57e, 0x576, 0x2, 0x574, 0x56d,
+};
+
+#endif // UNICODE_TABLES_H_INCLUDED
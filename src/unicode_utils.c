@@ -1 +1,959 @@
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
 
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+#include <textprocessing/unicode_utils.h>
+#include <textprocessing/textprocessing.h>
+#include "unicode_tables.h"
+
+// the flags of struct unicode_norm_record, they have to match tools/generate_unicode_tables.py
+#define NORM_NFD_NO     1   // has a canonical decomposition
+#define NORM_NFC_NO     2   // can't appear in NFC
+#define NORM_NFC_MAYBE  4   // can compose with the character before it
+#define NORM_NFD_START  8   // nothing before it gets reordered with it or anything after it in NFD
+#define NORM_NFC_START  16  // same for NFC, and it doesn't compose with what's before it
+#define NORM_NFD_FAST   32  // a starter that stays the same in NFD
+#define NORM_NFC_FAST   64  // a starter that stays the same in NFC and doesn't compose with what's before it
+
+#define HANGUL_S_BASE   0xac00
+#define HANGUL_L_BASE   0x1100
+#define HANGUL_V_BASE   0x1161
+#define HANGUL_T_BASE   0x11a7
+#define HANGUL_L_COUNT  19
+#define HANGUL_V_COUNT  21
+#define HANGUL_T_COUNT  28
+#define HANGUL_N_COUNT  (HANGUL_V_COUNT * HANGUL_T_COUNT)
+#define HANGUL_S_COUNT  (HANGUL_L_COUNT * HANGUL_N_COUNT)
+
+#define COMBINING_GRAPHEME_JOINER 0x34f
+
+// ill-formed code units are compared as FOLD_INVALID_BASE + the value of the unit
+#define FOLD_INVALID_BASE 0x110000
+
+#if UNICODE_FOLD_MAX_EXPANSION > UNICODE_MAX_FOLD
+    #error "UNICODE_MAX_FOLD is too small for the case folding tables"
+#endif
+
+// the longest full canonical decomposition is 4 characters
+#define NORM_MAX_DECOMPOSITION 4
+#define NORM_DECOMPOSED_SIZE (UNICODE_NORMALIZER_SEGMENT_SIZE * NORM_MAX_DECOMPOSITION)
+
+typedef struct norm_output
+{
+    textprocessing_arena_t *arena;
+    uint8_t *data;
+    size_t size;
+    size_t capacity;
+} norm_output_t;
+
+// goes through a text a folded character at a time
+typedef struct fold_cursor
+{
+    textprocessing_encoding_t enc;
+    const uint8_t *text;
+    size_t len;
+    size_t pos; // where the next character starts
+    // the folding of the last character, the ones from index on haven't been used yet
+    int32_t folded[UNICODE_MAX_FOLD];
+    int count;
+    int index;
+} fold_cursor_t;
+
+static inline const struct unicode_norm_record *unicode_norm_lookup(int32_t chr)
+{
+    if (chr < 0 || chr >= UNICODE_NORM_LIMIT)
+        return &unicode_norm_records[0];
+
+    int block = unicode_norm_stage1[chr >> UNICODE_NORM_SHIFT];
+    return &unicode_norm_records[unicode_norm_stage2[(block << UNICODE_NORM_SHIFT) + (chr & UNICODE_NORM_MASK)]];
+}
+
+uint8_t unicode_combining_class(int32_t chr)
+{
+    return unicode_norm_lookup(chr)->ccc;
+}
+
+static int unicode_norm_fast_flag(unicode_normalization_form_t form)
+{
+    return form == UNICODE_NFD ? NORM_NFD_FAST : NORM_NFC_FAST;
+}
+
+static int unicode_norm_start_flag(unicode_normalization_form_t form)
+{
+    return form == UNICODE_NFD ? NORM_NFD_START : NORM_NFC_START;
+}
+
+// how many bytes from the start are ascii
+static size_t unicode_ascii_run(const uint8_t *p, size_t len)
+{
+    size_t i = 0;
+#ifdef __SSE2__
+    for (; i + 16 <= len; i += 16)
+    {
+        int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(p + i)));
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+#endif
+    while (i < len && p[i] < 0x80)
+        ++i;
+
+    return i;
+}
+
+static int norm_output_reserve(norm_output_t *out, size_t extra)
+{
+    if (out->capacity - out->size >= extra)
+        return 0;
+
+    size_t new_capacity = out->capacity * 2;
+    if (new_capacity < out->size + extra)
+        new_capacity = out->size + extra;
+
+    uint8_t *new_data = textprocessing_arena_grow(out->arena, out->data, out->capacity, new_capacity);
+    if (new_data == NULL)
+        return -1;
+
+    out->data = new_data;
+    out->capacity = new_capacity;
+    return 0;
+}
+
+static int norm_output_write(norm_output_t *out, const uint8_t *bytes, size_t len)
+{
+    if (norm_output_reserve(out, len) != 0)
+        return -1;
+
+    memcpy(out->data + out->size, bytes, len);
+    out->size += len;
+    return 0;
+}
+
+static int unicode_hangul_decompose(int32_t chr, int32_t *out)
+{
+    int32_t s = chr - HANGUL_S_BASE;
+    out[0] = HANGUL_L_BASE + s / HANGUL_N_COUNT;
+    out[1] = HANGUL_V_BASE + (s % HANGUL_N_COUNT) / HANGUL_T_COUNT;
+    if (s % HANGUL_T_COUNT == 0)
+        return 2;
+
+    out[2] = HANGUL_T_BASE + s % HANGUL_T_COUNT;
+    return 3;
+}
+
+// returns the primary composite of the two characters or -1 if there isn't one
+static int32_t unicode_compose(int32_t first, int32_t second)
+{
+    if (first >= HANGUL_L_BASE && first < HANGUL_L_BASE + HANGUL_L_COUNT
+        && second >= HANGUL_V_BASE && second < HANGUL_V_BASE + HANGUL_V_COUNT)
+        return HANGUL_S_BASE + ((first - HANGUL_L_BASE) * HANGUL_V_COUNT + second - HANGUL_V_BASE) * HANGUL_T_COUNT;
+
+    if (first >= HANGUL_S_BASE && first < HANGUL_S_BASE + HANGUL_S_COUNT && (first - HANGUL_S_BASE) % HANGUL_T_COUNT == 0
+        && second > HANGUL_T_BASE && second < HANGUL_T_BASE + HANGUL_T_COUNT)
+        return first + second - HANGUL_T_BASE;
+
+    size_t lo = 0, hi = sizeof(unicode_norm_compositions) / sizeof(*unicode_norm_compositions);
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        const struct unicode_norm_composition *c = &unicode_norm_compositions[mid];
+        if (first < c->first || (first == c->first && second < c->second))
+            hi = mid;
+        else if (first > c->first || second > c->second)
+            lo = mid + 1;
+        else return c->composite;
+    }
+    return -1;
+}
+
+/*
+ *  normalizes the segment in the normalizer into the output:
+ *      1. every character is replaced by its full canonical decomposition
+ *      2. the non starters are sorted by their combining class (stable)
+ *      3. for NFC the characters are composed back with the last starter that isn't blocked from them
+ */
+static int unicode_flush_segment(unicode_normalizer_t *normalizer, norm_output_t *out)
+{
+    if (normalizer->segment_len == 0)
+        return 0;
+
+    int32_t chars[NORM_DECOMPOSED_SIZE];
+    uint8_t ccc[NORM_DECOMPOSED_SIZE];
+    size_t count = 0;
+    for (size_t i = 0; i < normalizer->segment_len; ++i)
+    {
+        int32_t chr = normalizer->segment[i];
+        const struct unicode_norm_record *record = unicode_norm_lookup(chr);
+        if (chr >= HANGUL_S_BASE && chr < HANGUL_S_BASE + HANGUL_S_COUNT)
+            count += unicode_hangul_decompose(chr, chars + count);
+        else if (record->decomposition != 0)
+        {
+            const int32_t *decomposition = unicode_norm_decompositions + record->decomposition;
+            memcpy(chars + count, decomposition + 1, decomposition[0] * sizeof(int32_t));
+            count += decomposition[0];
+        }
+        else chars[count++] = chr;
+    }
+    normalizer->segment_len = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        ccc[i] = unicode_norm_lookup(chars[i])->ccc;
+        if (ccc[i] == 0)
+            continue;
+
+        // insertion sort, starters are never moved
+        for (size_t j = i; j > 0 && ccc[j - 1] > ccc[j]; --j)
+        {
+            int32_t tmp_chr = chars[j];
+            chars[j] = chars[j - 1];
+            chars[j - 1] = tmp_chr;
+
+            uint8_t tmp_ccc = ccc[j];
+            ccc[j] = ccc[j - 1];
+            ccc[j - 1] = tmp_ccc;
+        }
+    }
+
+    if (normalizer->form == UNICODE_NFC && count > 1)
+    {
+        size_t starter = ccc[0] == 0 ? 0 : SIZE_MAX;
+        uint8_t last_ccc = ccc[0];
+        size_t kept = 1;
+        for (size_t i = 1; i < count; ++i)
+        {
+            // a character is blocked from the starter if there's a starter or a character
+            // with the same or a higher combining class in between
+            int blocked = starter == SIZE_MAX || (kept - 1 != starter && (last_ccc == 0 || last_ccc >= ccc[i]));
+            int32_t composite = blocked ? -1 : unicode_compose(chars[starter], chars[i]);
+            if (composite >= 0)
+            {
+                chars[starter] = composite;
+                continue;
+            }
+            if (ccc[i] == 0)
+                starter = kept;
+
+            last_ccc = ccc[i];
+            chars[kept] = chars[i];
+            ccc[kept] = ccc[i];
+            ++kept;
+        }
+        count = kept;
+    }
+
+    if (norm_output_reserve(out, count * 4) != 0)
+        return -1;
+
+    for (size_t i = 0; i < count; ++i)
+        out->size += textprocessing_encode_chr(TPENC_UTF8, chars[i], out->data + out->size);
+
+    return 0;
+}
+
+// adds a character that has to go through the slow path to the segment
+static int unicode_normalizer_push(unicode_normalizer_t *normalizer, int32_t chr, norm_output_t *out)
+{
+    const struct unicode_norm_record *record = unicode_norm_lookup(chr);
+    if (record->flags & unicode_norm_start_flag(normalizer->form))
+    {
+        if (unicode_flush_segment(normalizer, out) != 0)
+            return -1;
+    }
+    else if (normalizer->segment_len == UNICODE_NORMALIZER_SEGMENT_SIZE)
+    {
+        if (unicode_flush_segment(normalizer, out) != 0)
+            return -1;
+
+        normalizer->segment[normalizer->segment_len++] = COMBINING_GRAPHEME_JOINER;
+    }
+    normalizer->segment[normalizer->segment_len++] = chr;
+    return 0;
+}
+
+void unicode_normalizer_init(unicode_normalizer_t *normalizer, unicode_normalization_form_t form)
+{
+    normalizer->form = form;
+    normalizer->segment_len = 0;
+    normalizer->partial_len = 0;
+}
+
+static char *unicode_normalizer_fail(norm_output_t *out, int error)
+{
+    textprocessing_arena_grow(out->arena, out->data, out->capacity, 0);
+    errno = error;
+    return NULL;
+}
+
+char *unicode_normalizer_feed(unicode_normalizer_t *normalizer, const void *chunk, size_t len, int is_last,
+                              textprocessing_arena_t *arena, size_t *out_len)
+{
+    const uint8_t *text = chunk;
+    norm_output_t out = {
+        .arena = arena,
+        .capacity = len + len / 4 + 64
+    };
+    out.data = textprocessing_arena_alloc(arena, out.capacity);
+    if (out.data == NULL)
+        return NULL;
+
+    int fast_flag = unicode_norm_fast_flag(normalizer->form);
+    size_t pos = 0;
+    int32_t chr;
+
+    // finish the character that the previous chunk ended in the middle of
+    if (normalizer->partial_len != 0)
+    {
+        uint8_t joined[4];
+        size_t taken = (size_t)(4 - normalizer->partial_len);
+        if (taken > len)
+            taken = len;
+
+        memcpy(joined, normalizer->partial, normalizer->partial_len);
+        memcpy(joined + normalizer->partial_len, text, taken);
+
+        int got = textprocessing_decode_chr(TPENC_UTF8, joined, normalizer->partial_len + taken, &chr);
+        if (got < 0)
+            return unicode_normalizer_fail(&out, EILSEQ);
+
+        if (got == 0)
+        {
+            memcpy(normalizer->partial + normalizer->partial_len, text, taken);
+            normalizer->partial_len += taken;
+            pos = len;
+        }
+        else
+        {
+            pos = got - normalizer->partial_len;
+            normalizer->partial_len = 0;
+            if (unicode_normalizer_push(normalizer, chr, &out) != 0)
+                return unicode_normalizer_fail(&out, ENOMEM);
+        }
+    }
+
+    // the characters that don't change and can't be changed by what comes after them are copied as they are,
+    // only the last one of a run (last_start) is held back since the next character could still combine with it
+    size_t run_start = 0;
+    size_t last_start = SIZE_MAX;
+    while (pos < len)
+    {
+        size_t start = pos;
+        size_t char_start;
+        if (text[pos] < 0x80)
+        {
+            pos += unicode_ascii_run(text + pos, len - pos);
+            char_start = pos - 1;
+        }
+        else
+        {
+            int got = textprocessing_decode_chr(TPENC_UTF8, text + pos, len - pos, &chr);
+            if (got < 0)
+                return unicode_normalizer_fail(&out, EILSEQ);
+
+            if (got == 0)
+                break;
+
+            if ((unicode_norm_lookup(chr)->flags & fast_flag) == 0)
+            {
+                if (last_start != SIZE_MAX)
+                {
+                    int32_t held;
+                    if (norm_output_write(&out, text + run_start, last_start - run_start) != 0)
+                        return unicode_normalizer_fail(&out, ENOMEM);
+
+                    textprocessing_decode_chr(TPENC_UTF8, text + last_start, len - last_start, &held);
+                    normalizer->segment[normalizer->segment_len++] = held;
+                    last_start = SIZE_MAX;
+                }
+                if (unicode_normalizer_push(normalizer, chr, &out) != 0)
+                    return unicode_normalizer_fail(&out, ENOMEM);
+
+                pos += got;
+                continue;
+            }
+            char_start = pos;
+            pos += got;
+        }
+
+        if (last_start == SIZE_MAX)
+        {
+            // a new run, the segment before it can't change anymore
+            if (unicode_flush_segment(normalizer, &out) != 0)
+                return unicode_normalizer_fail(&out, ENOMEM);
+
+            run_start = start;
+        }
+        last_start = char_start;
+    }
+
+    if (last_start != SIZE_MAX)
+    {
+        int32_t held;
+        if (norm_output_write(&out, text + run_start, last_start - run_start) != 0)
+            return unicode_normalizer_fail(&out, ENOMEM);
+
+        textprocessing_decode_chr(TPENC_UTF8, text + last_start, len - last_start, &held);
+        normalizer->segment[normalizer->segment_len++] = held;
+    }
+    if (pos < len)
+    {
+        memcpy(normalizer->partial, text + pos, len - pos);
+        normalizer->partial_len = len - pos;
+    }
+
+    if (is_last)
+    {
+        if (normalizer->partial_len != 0)
+        {
+            normalizer->partial_len = 0;
+            normalizer->segment_len = 0;
+            return unicode_normalizer_fail(&out, EILSEQ);
+        }
+        if (unicode_flush_segment(normalizer, &out) != 0)
+            return unicode_normalizer_fail(&out, ENOMEM);
+    }
+
+    if (norm_output_reserve(&out, 1) != 0)
+        return unicode_normalizer_fail(&out, ENOMEM);
+
+    out.data[out.size] = 0;
+    out.data = textprocessing_arena_grow(arena, out.data, out.capacity, out.size + 1);
+    if (out_len != NULL)
+        *out_len = out.size;
+
+    return (char*)out.data;
+}
+
+char *unicode_normalize(unicode_normalization_form_t form, const void *text, size_t len,
+                        textprocessing_arena_t *arena, size_t *out_len)
+{
+    unicode_normalizer_t normalizer;
+    unicode_normalizer_init(&normalizer, form);
+    return unicode_normalizer_feed(&normalizer, text, len, 1, arena, out_len);
+}
+
+int unicode_is_normalized(unicode_normalization_form_t form, const void *text, size_t len)
+{
+    const uint8_t *bytes = text;
+    int maybe = 0;
+    uint8_t last_ccc = 0;
+    size_t pos = 0;
+    while (pos < len)
+    {
+        if (bytes[pos] < 0x80)
+        {
+            pos += unicode_ascii_run(bytes + pos, len - pos);
+            last_ccc = 0;
+            continue;
+        }
+
+        int32_t chr;
+        int got = textprocessing_decode_chr(TPENC_UTF8, bytes + pos, len - pos, &chr);
+        if (got <= 0)
+        {
+            errno = EILSEQ;
+            return -1;
+        }
+        pos += got;
+
+        const struct unicode_norm_record *record = unicode_norm_lookup(chr);
+        if (record->ccc != 0 && last_ccc > record->ccc)
+            return 0;
+
+        if (form == UNICODE_NFD ? (record->flags & NORM_NFD_NO) : (record->flags & NORM_NFC_NO))
+            return 0;
+
+        if (form == UNICODE_NFC && (record->flags & NORM_NFC_MAYBE))
+            maybe = 1;
+
+        last_ccc = record->ccc;
+    }
+    if (!maybe)
+        return 1;
+
+    // the quick check can't tell, so compare it to the normalized text
+    textprocessing_arena_t arena;
+    textprocessing_arena_init(&arena, len + 64);
+
+    size_t normalized_len;
+    char *normalized = unicode_normalize(form, text, len, &arena, &normalized_len);
+    int rv = normalized == NULL ? -1 : normalized_len == len && memcmp(normalized, text, len) == 0;
+
+    textprocessing_arena_free(&arena);
+    return rv;
+}
+
+int unicode_casefold(int32_t chr, int32_t *out)
+{
+    if (chr < 0x80)
+    {
+        out[0] = chr >= 'A' && chr <= 'Z' ? chr + 32 : chr;
+        return 1;
+    }
+    if (chr < UNICODE_FOLD_LIMIT)
+    {
+        int block = unicode_fold_stage1[chr >> UNICODE_FOLD_SHIFT];
+        const struct unicode_fold_record *record =
+            &unicode_fold_records[unicode_fold_stage2[(block << UNICODE_FOLD_SHIFT) + (chr & UNICODE_FOLD_MASK)]];
+        if (record->expansion != 0)
+        {
+            const int32_t *expansion = unicode_fold_expansions + record->expansion;
+            memcpy(out, expansion + 1, expansion[0] * sizeof(int32_t));
+            return expansion[0];
+        }
+        chr += record->delta;
+    }
+    out[0] = chr;
+    return 1;
+}
+
+// the encodings where every ascii byte is an ascii character
+static int fold_is_byte_encoding(textprocessing_encoding_t enc)
+{
+    return enc == TPENC_ASCII || enc == TPENC_UTF8 || enc == TPENC_LATIN1 || enc == TPENC_CP1252;
+}
+
+static void fold_cursor_init(fold_cursor_t *cursor, textprocessing_encoding_t enc, const void *text, size_t len, size_t pos)
+{
+    cursor->enc = enc;
+    cursor->text = text;
+    cursor->len = len;
+    cursor->pos = pos;
+    cursor->count = 0;
+    cursor->index = 0;
+}
+
+#define fold_cursor_at_boundary(cursor) ((cursor)->index == (cursor)->count)
+
+// returns 0 at the end of the text
+static inline int fold_cursor_next(fold_cursor_t *cursor, int32_t *chr)
+{
+    if (cursor->index == cursor->count)
+    {
+        if (cursor->pos >= cursor->len)
+            return 0;
+
+        const uint8_t *p = cursor->text + cursor->pos;
+        size_t avail = cursor->len - cursor->pos;
+        int32_t decoded;
+        int got = textprocessing_decode_chr(cursor->enc, p, avail, &decoded);
+        if (got <= 0)
+        {
+            // an ill-formed or cut off sequence, it's skipped a code unit at a time
+            got = textprocessing_unit_size(cursor->enc);
+            if ((size_t)got > avail)
+                got = (int)avail;
+
+            uint32_t unit = 0;
+            for (int i = 0; i < got; ++i)
+                unit = unit << 8 | p[i];
+
+            decoded = (int32_t)(FOLD_INVALID_BASE + unit);
+        }
+        cursor->pos += got;
+        cursor->count = unicode_casefold(decoded, cursor->folded);
+        cursor->index = 0;
+    }
+    *chr = cursor->folded[cursor->index++];
+    return 1;
+}
+
+#if defined(__AVX2__)
+static inline __m256i fold_ascii32(__m256i x)
+{
+    // the compares are signed, the bytes from 0x80 on are negative so they never count as upper case
+    __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(x, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), x));
+    return _mm256_or_si256(x, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+}
+#elif defined(__SSE2__)
+static inline __m128i fold_ascii16(__m128i x)
+{
+    // the compares are signed, the bytes from 0x80 on are negative so they never count as upper case
+    __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(x, _mm_set1_epi8('Z' + 1)));
+    return _mm_or_si128(x, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+#endif
+
+static inline uint8_t fold_ascii(uint8_t c)
+{
+    return c >= 'A' && c <= 'Z' ? c + 32 : c;
+}
+
+// how many bytes from the start of a and b are ascii and the same after folding
+static size_t fold_ascii_equal_run(const uint8_t *a, const uint8_t *b, size_t len)
+{
+    size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 32 <= len; i += 32)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        uint32_t stop = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(fold_ascii32(x), fold_ascii32(y)))
+                      | (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(x, y));
+        if (stop)
+            return i + __builtin_ctz(stop);
+    }
+#elif defined(__SSE2__)
+    for (; i + 32 <= len; i += 32)
+    {
+        __m128i x0 = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i x1 = _mm_loadu_si128((const __m128i*)(a + i + 16));
+        __m128i y0 = _mm_loadu_si128((const __m128i*)(b + i));
+        __m128i y1 = _mm_loadu_si128((const __m128i*)(b + i + 16));
+        uint32_t equal = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(fold_ascii16(x0), fold_ascii16(y0)))
+                       | (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(fold_ascii16(x1), fold_ascii16(y1))) << 16;
+        uint32_t high = (uint32_t)_mm_movemask_epi8(_mm_or_si128(x0, y0))
+                      | (uint32_t)_mm_movemask_epi8(_mm_or_si128(x1, y1)) << 16;
+        uint32_t stop = ~equal | high;
+        if (stop)
+            return i + __builtin_ctz(stop);
+    }
+#endif
+    while (i < len && (a[i] | b[i]) < 0x80 && fold_ascii(a[i]) == fold_ascii(b[i]))
+        ++i;
+
+    return i;
+}
+
+// skips what's the same ascii text in both, which is most of the text usually
+static inline void fold_skip_ascii(fold_cursor_t *a, fold_cursor_t *b)
+{
+    if (!fold_cursor_at_boundary(a) || !fold_cursor_at_boundary(b) || a->pos >= a->len || b->pos >= b->len
+        || (a->text[a->pos] | b->text[b->pos]) >= 0x80)
+        return;
+
+    size_t avail = a->len - a->pos < b->len - b->pos ? a->len - a->pos : b->len - b->pos;
+    size_t run = fold_ascii_equal_run(a->text + a->pos, b->text + b->pos, avail);
+    a->pos += run;
+    b->pos += run;
+}
+
+/*
+ *  finds the first byte that could start a character whose folding starts with first:
+ *  first (after folding the byte) if it's ascii, or any byte from high on
+ *  high is 0xc0 for utf-8 so only lead bytes are found, those and the ascii bytes are always at character boundaries
+ */
+static size_t fold_find_candidate(const uint8_t *p, size_t len, uint8_t first, uint8_t high)
+{
+    size_t i = 0;
+#if defined(__AVX2__)
+    __m256i first_vec = _mm256_set1_epi8((char)first);
+    __m256i high_vec = _mm256_set1_epi8((char)high);
+    for (; i + 32 <= len; i += 32)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(p + i));
+        __m256i hits = _mm256_or_si256(_mm256_cmpeq_epi8(fold_ascii32(x), first_vec),
+                                       _mm256_cmpeq_epi8(_mm256_max_epu8(x, high_vec), x));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(hits);
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+#elif defined(__SSE2__)
+    __m128i first_vec = _mm_set1_epi8((char)first);
+    __m128i high_vec = _mm_set1_epi8((char)high);
+    for (; i + 32 <= len; i += 32)
+    {
+        __m128i x0 = _mm_loadu_si128((const __m128i*)(p + i));
+        __m128i x1 = _mm_loadu_si128((const __m128i*)(p + i + 16));
+        __m128i hits0 = _mm_or_si128(_mm_cmpeq_epi8(fold_ascii16(x0), first_vec), _mm_cmpeq_epi8(_mm_max_epu8(x0, high_vec), x0));
+        __m128i hits1 = _mm_or_si128(_mm_cmpeq_epi8(fold_ascii16(x1), first_vec), _mm_cmpeq_epi8(_mm_max_epu8(x1, high_vec), x1));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(hits0) | (uint32_t)_mm_movemask_epi8(hits1) << 16;
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+#endif
+    while (i < len && fold_ascii(p[i]) != first && p[i] < high)
+        ++i;
+
+    return i;
+}
+
+// returns 1 if the rest of pattern matches the text from where the cursor is and ends at a character boundary of it
+static int fold_match(fold_cursor_t *text, fold_cursor_t *pattern)
+{
+    int ascii = fold_is_byte_encoding(text->enc) && fold_is_byte_encoding(pattern->enc);
+    for (;;)
+    {
+        if (ascii)
+            fold_skip_ascii(text, pattern);
+
+        int32_t p, t;
+        if (!fold_cursor_next(pattern, &p))
+            return fold_cursor_at_boundary(text);
+
+        if (!fold_cursor_next(text, &t) || t != p)
+            return 0;
+    }
+}
+
+static int fold_search(textprocessing_encoding_t enc, const uint8_t *haystack, size_t len,
+                       textprocessing_encoding_t needle_enc, const void *needle, size_t needle_len,
+                       size_t *match_start, size_t *match_len)
+{
+    fold_cursor_t pattern;
+    fold_cursor_init(&pattern, needle_enc, needle, needle_len, 0);
+
+    int32_t first = 0;
+    size_t start = 0, end = 0;
+    int found = !fold_cursor_next(&pattern, &first);
+
+    // in the byte encodings the text is only decoded where the first character could be,
+    // an ascii character only comes out of folding ascii characters and a handful of non ascii ones
+    int byte_scan = fold_is_byte_encoding(enc) && first < FOLD_INVALID_BASE;
+    uint8_t high = enc == TPENC_UTF8 ? 0xc0 : 0x80;
+    uint8_t first_byte = first < 0x80 ? (uint8_t)first : high;
+
+    size_t pos = 0;
+    while (!found && pos < len)
+    {
+        if (byte_scan)
+        {
+            pos += fold_find_candidate(haystack + pos, len - pos, first_byte, high);
+            if (pos >= len)
+                break;
+        }
+        fold_cursor_t text;
+        fold_cursor_init(&text, enc, haystack, len, pos);
+
+        int32_t chr = -1;
+        fold_cursor_next(&text, &chr);
+        size_t next = text.pos;
+        if (chr == first)
+        {
+            fold_cursor_t rest = pattern;
+            if (fold_match(&text, &rest))
+            {
+                found = 1;
+                start = pos;
+                end = text.pos;
+            }
+        }
+        pos = next;
+    }
+    if (found)
+    {
+        if (match_start != NULL)
+            *match_start = start;
+        if (match_len != NULL)
+            *match_len = end - start;
+    }
+    return found;
+}
+
+int textprocessing_casecmp(textprocessing_encoding_t enc, const void *a, size_t a_len, const void *b, size_t b_len)
+{
+    fold_cursor_t x, y;
+    fold_cursor_init(&x, enc, a, a_len, 0);
+    fold_cursor_init(&y, enc, b, b_len, 0);
+
+    int ascii = fold_is_byte_encoding(enc);
+    for (;;)
+    {
+        if (ascii)
+            fold_skip_ascii(&x, &y);
+
+        int32_t x_chr, y_chr;
+        int x_got = fold_cursor_next(&x, &x_chr);
+        int y_got = fold_cursor_next(&y, &y_chr);
+        if (!x_got || !y_got)
+            return x_got - y_got;
+
+        if (x_chr != y_chr)
+            return x_chr < y_chr ? -1 : 1;
+    }
+}
+
+int textprocessing_caseprefix(textprocessing_encoding_t enc, const void *text, size_t len, const void *prefix, size_t prefix_len,
+                              size_t *matched_len)
+{
+    fold_cursor_t text_cursor, prefix_cursor;
+    fold_cursor_init(&text_cursor, enc, text, len, 0);
+    fold_cursor_init(&prefix_cursor, enc, prefix, prefix_len, 0);
+
+    int matched = fold_match(&text_cursor, &prefix_cursor);
+    if (matched && matched_len != NULL)
+        *matched_len = text_cursor.pos;
+
+    return matched;
+}
+
+int textprocessing_casesearch(textprocessing_encoding_t enc, const void *haystack, size_t len, const void *needle, size_t needle_len,
+                              size_t *match_start, size_t *match_len)
+{
+    return fold_search(enc, haystack, len, enc, needle, needle_len, match_start, match_len);
+}
+
+// returns how many characters the utf-8 text folds into or -1 (EILSEQ) if it isn't valid
+static long fold_utf8_length(const char *text, size_t len)
+{
+    long folded_len = 0;
+    size_t pos = 0;
+    while (pos < len)
+    {
+        int32_t chr, folded[UNICODE_MAX_FOLD];
+        int got = textprocessing_decode_chr(TPENC_UTF8, (const uint8_t*)text + pos, len - pos, &chr);
+        if (got <= 0)
+        {
+            errno = EILSEQ;
+            return -1;
+        }
+        pos += got;
+        folded_len += unicode_casefold(chr, folded);
+    }
+    return folded_len;
+}
+
+int textreader_caseprefix(textreader_t *reader, const char *prefix, size_t prefix_len)
+{
+    long folded_len = fold_utf8_length(prefix, prefix_len);
+    if (folded_len < 0)
+        return -1;
+
+    // every character that's read folds into at least one character, so at most folded_len have to be put back
+    int32_t read[TEXTREADER_PUSHBACK_BUFFER_SIZE / 4];
+    if (folded_len > (long)(sizeof(read) / sizeof(*read)))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    fold_cursor_t pattern;
+    fold_cursor_init(&pattern, TPENC_UTF8, prefix, prefix_len, 0);
+
+    size_t read_count = 0;
+    int32_t folded[UNICODE_MAX_FOLD];
+    int count = 0, index = 0;
+    int matched = 1;
+    int32_t p;
+    while (matched == 1 && fold_cursor_next(&pattern, &p))
+    {
+        if (index == count)
+        {
+            int32_t chr = textreader_getc(reader);
+            if (chr == EOF)
+            {
+                matched = textreader_error(reader) ? -1 : 0;
+                break;
+            }
+            read[read_count++] = chr;
+            count = unicode_casefold(chr, folded);
+            index = 0;
+        }
+        if (folded[index++] != p)
+            matched = 0;
+    }
+    if (matched == 1 && index == count)
+        return 1;
+
+    while (read_count > 0)
+    {
+        if (textreader_ungetc(reader, read[--read_count]) != 0)
+            return -1;
+    }
+    return matched == 1 ? 0 : matched;
+}
+
+/*
+ *  the needle is folded up front and the text is matched against it a folded character at a time with knuth-morris-pratt
+ *  boundary remembers which of the last folded characters started a character of the text, a match that ends
+ *  at the end of a character only counts if it also started at the start of one
+ */
+static int fold_search_reader(textreader_t *reader, const char *needle, size_t needle_len, size_t folded_len)
+{
+    int32_t *pattern = malloc(folded_len * sizeof(int32_t));
+    size_t *fail = malloc(folded_len * sizeof(size_t));
+    uint8_t *boundary = malloc(folded_len + 1);
+    if (pattern == NULL || fail == NULL || boundary == NULL)
+    {
+        free(pattern);
+        free(fail);
+        free(boundary);
+        errno = ENOMEM;
+        return -1;
+    }
+
+    fold_cursor_t cursor;
+    fold_cursor_init(&cursor, TPENC_UTF8, needle, needle_len, 0);
+    for (size_t i = 0; i < folded_len; ++i)
+        fold_cursor_next(&cursor, &pattern[i]);
+
+    fail[0] = 0;
+    for (size_t i = 1, k = 0; i < folded_len; ++i)
+    {
+        while (k > 0 && pattern[i] != pattern[k])
+            k = fail[k - 1];
+        if (pattern[i] == pattern[k])
+            ++k;
+
+        fail[i] = k;
+    }
+
+    size_t matched = 0;
+    size_t folded_index = 0;
+    int rv;
+    for (;;)
+    {
+        int32_t chr = textreader_getc_inline(reader);
+        if (chr == EOF)
+        {
+            rv = textreader_error(reader) ? -1 : 0;
+            break;
+        }
+        int32_t folded[UNICODE_MAX_FOLD];
+        int count = unicode_casefold(chr, folded);
+        int found = 0;
+        for (int i = 0; i < count && !found; ++i)
+        {
+            boundary[folded_index++ % (folded_len + 1)] = i == 0;
+            while (matched > 0 && pattern[matched] != folded[i])
+                matched = fail[matched - 1];
+            if (pattern[matched] == folded[i])
+                ++matched;
+
+            if (matched == folded_len)
+            {
+                found = i == count - 1 && boundary[(folded_index - folded_len) % (folded_len + 1)];
+                matched = fail[folded_len - 1];
+            }
+        }
+        if (found)
+        {
+            rv = 1;
+            break;
+        }
+    }
+    free(pattern);
+    free(fail);
+    free(boundary);
+    return rv;
+}
+
+int textreader_casesearch(textreader_t *reader, const char *needle, size_t needle_len)
+{
+    long folded_len = fold_utf8_length(needle, needle_len);
+    if (folded_len <= 0)
+        return folded_len < 0 ? -1 : 1;
+
+    if ((reader->flags & TRFLG_ISMEM) == 0 || reader->ungetc_stack.size != 0
+        || reader->data.mem.index > reader->data.mem.size)
+        return fold_search_reader(reader, needle, needle_len, (size_t)folded_len);
+
+    size_t index = reader->data.mem.index;
+    size_t size = reader->data.mem.size;
+    size_t start, match_len;
+    int found = fold_search(reader->encoding, (const uint8_t*)reader->data.mem.mem + index, size - index,
+                            TPENC_UTF8, needle, needle_len, &start, &match_len);
+
+    // seeking keeps the position tracking right
+    textreader_seeko(reader, (off_t)(found ? index + start + match_len : size), SEEK_SET);
+    if (!found)
+        reader->flags |= TRFLG_EOF;
+
+    return found;
+}
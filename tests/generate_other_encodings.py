@@ -67,6 +67,12 @@ converted_encodings = (
     
     ("utf-8", "utf-8"),
     ("utf-8-bom", "utf-8", b"\xEF\xBB\xBF"),
+
+    ("utf-32-be", "utf-32be"),
+    ("utf-32-be-bom", "utf-32be", b"\x00\x00\xfe\xff"),
+
+    ("utf-32-le", "utf-32le"),
+    ("utf-32-le-bom", "utf-32le", b"\xff\xfe\x00\x00"),
 );
 
 file_path_extension = get_path_extension(file_path);
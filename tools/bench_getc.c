@@ -0,0 +1,187 @@
+// bench_getc - compares textreader_getc with the inline fast path in textreader.h
+//
+// usage: bench_getc [FILE]
+//
+// decodes mostly ascii text (with some 2 and 3 byte characters in it) one character at a time,
+// from memory as utf-8 and utf-16le and, if FILE is given, from FILE (read as utf-8) with prefetching on
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <textprocessing/textprocessing.h>
+#include <textprocessing/textreader.h>
+
+#define BENCH_TEXT_CHARS (32 * 1024 * 1024)
+#define BENCH_ROUNDS     5
+
+typedef int32_t (*bench_getc_fn)(textreader_t *reader);
+
+static int32_t bench_getc_call(textreader_t *reader)
+{
+    return textreader_getc(reader);
+}
+
+static double bench_now(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// the loops are written out twice so the inline one really gets inlined
+static double bench_mem(const void *text, size_t len, textprocessing_encoding_t enc, int use_inline, size_t *chars, uint32_t *sum)
+{
+    double best = 0;
+    for (int round = 0; round < BENCH_ROUNDS; ++round)
+    {
+        textreader_t reader = textreader_openmem(text, len, enc);
+        size_t n = 0;
+        uint32_t s = 0;
+        double start = bench_now();
+        int32_t chr;
+        if (use_inline)
+        {
+            while ((chr = textreader_getc_inline(&reader)) != EOF)
+            {
+                s += chr;
+                ++n;
+            }
+        }
+        else
+        {
+            bench_getc_fn getc_fn = bench_getc_call;
+            while ((chr = getc_fn(&reader)) != EOF)
+            {
+                s += chr;
+                ++n;
+            }
+        }
+        double elapsed = bench_now() - start;
+        if (round == 0 || elapsed < best)
+            best = elapsed;
+
+        *chars = n;
+        *sum = s;
+        textreader_close(&reader, 0);
+    }
+    return best;
+}
+
+static double bench_file(const char *path, int use_inline, size_t *chars, uint32_t *sum)
+{
+    double best = 0;
+    for (int round = 0; round < BENCH_ROUNDS; ++round)
+    {
+        FILE *file = fopen(path, "rb");
+        if (file == NULL)
+            return -1;
+
+        textreader_t reader = textreader_openfileptr(file, TPENC_UTF8);
+        int prefetching = textreader_prefetch(&reader, 1) == 0;
+        size_t n = 0;
+        uint32_t s = 0;
+        double start = bench_now();
+        int32_t chr;
+        if (use_inline)
+        {
+            while ((chr = textreader_getc_inline(&reader)) != EOF)
+            {
+                s += chr;
+                ++n;
+            }
+        }
+        else
+        {
+            while ((chr = textreader_getc(&reader)) != EOF)
+            {
+                s += chr;
+                ++n;
+            }
+        }
+        double elapsed = bench_now() - start;
+        if (round == 0 || elapsed < best)
+            best = elapsed;
+
+        *chars = n;
+        *sum = s;
+        textreader_close(&reader, 1);
+        if (!prefetching && round == 0)
+            fprintf(stderr, "bench_getc: couldn't turn prefetching on, reading through the FILE\n");
+    }
+    return best;
+}
+
+static void bench_report(const char *name, size_t bytes, double plain, double inlined, size_t chars)
+{
+    printf("%-24s getc %7.1f MB/s %6.2f ns/char   inline %7.1f MB/s %6.2f ns/char   %.2fx\n", name,
+        bytes / plain / 1e6, plain * 1e9 / chars, bytes / inlined / 1e6, inlined * 1e9 / chars, plain / inlined);
+}
+
+int main(int argc, char **argv)
+{
+    // mostly ascii words, every 20th character is an accented latin letter and every 50th a cjk one
+    int32_t *chrs = malloc(BENCH_TEXT_CHARS * sizeof(int32_t));
+    uint8_t *utf8 = malloc(BENCH_TEXT_CHARS * 4);
+    uint8_t *utf16 = malloc(BENCH_TEXT_CHARS * 4);
+    if (chrs == NULL || utf8 == NULL || utf16 == NULL)
+    {
+        fprintf(stderr, "bench_getc: out of memory\n");
+        return 1;
+    }
+    uint32_t seed = 1;
+    for (size_t i = 0; i < BENCH_TEXT_CHARS; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        uint32_t r = (seed >> 8) % 100;
+        if (r < 2)
+            chrs[i] = 0x4e00 + (seed >> 16) % 0x5000;
+        else if (r < 7)
+            chrs[i] = 0xc0 + (seed >> 16) % 0x40;
+        else if (r < 22)
+            chrs[i] = r < 20 ? ' ' : '\n';
+        else chrs[i] = 'a' + (seed >> 16) % 26;
+    }
+    size_t encoded;
+    size_t utf8_len = textprocessing_encode_chrs(TPENC_UTF8, chrs, BENCH_TEXT_CHARS, utf8, &encoded);
+    size_t utf16_len = textprocessing_encode_chrs(TPENC_UTF16LE, chrs, BENCH_TEXT_CHARS, utf16, &encoded);
+
+    size_t chars, inline_chars;
+    uint32_t sum, inline_sum;
+    double plain = bench_mem(utf8, utf8_len, TPENC_UTF8, 0, &chars, &sum);
+    double inlined = bench_mem(utf8, utf8_len, TPENC_UTF8, 1, &inline_chars, &inline_sum);
+    bench_report("memory utf-8", utf8_len, plain, inlined, chars);
+    int mismatch = chars != inline_chars || sum != inline_sum;
+
+    plain = bench_mem(utf16, utf16_len, TPENC_UTF16LE, 0, &chars, &sum);
+    inlined = bench_mem(utf16, utf16_len, TPENC_UTF16LE, 1, &inline_chars, &inline_sum);
+    bench_report("memory utf-16le", utf16_len, plain, inlined, chars);
+    mismatch |= chars != inline_chars || sum != inline_sum;
+
+    if (argc > 1)
+    {
+        plain = bench_file(argv[1], 0, &chars, &sum);
+        inlined = bench_file(argv[1], 1, &inline_chars, &inline_sum);
+        if (plain < 0 || inlined < 0)
+        {
+            fprintf(stderr, "bench_getc: can't open %s\n", argv[1]);
+            return 1;
+        }
+        FILE *file = fopen(argv[1], "rb");
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        fclose(file);
+        bench_report("file utf-8 (prefetch)", size, plain, inlined, chars);
+        mismatch |= chars != inline_chars || sum != inline_sum;
+    }
+    free(chrs);
+    free(utf8);
+    free(utf16);
+    if (mismatch)
+    {
+        fprintf(stderr, "bench_getc: the inline getc decoded something different\n");
+        return 1;
+    }
+    return 0;
+}
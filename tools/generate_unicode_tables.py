@@ -0,0 +1,338 @@
+"""
+    Generates src/unicode_tables.h from the unicode database that comes with python (unicodedata)
+    The tables are only as new as the python that generated them, the version is written into the header
+    The case folding tables come from str.casefold, which is the full case folding of CaseFolding.txt (statuses C and F)
+
+    Usage:
+        generate_unicode_tables.py [output file]
+"""
+
+import sys;
+import os;
+import unicodedata;
+
+MAX_CODE_POINT = 0x10ffff;
+BLOCK_SHIFT = 6;
+BLOCK_SIZE = 1 << BLOCK_SHIFT;
+
+HANGUL_S_BASE = 0xac00;
+HANGUL_S_COUNT = 11172;
+HANGUL_V_FIRST, HANGUL_V_LAST = 0x1161, 0x1175;
+HANGUL_T_FIRST, HANGUL_T_LAST = 0x11a8, 0x11c2;
+
+# has to match the NORM_* flags in unicode_utils.c
+NORM_NFD_NO     = 1;
+NORM_NFC_NO     = 2;
+NORM_NFC_MAYBE  = 4;
+NORM_NFD_START  = 8;
+NORM_NFC_START  = 16;
+NORM_NFD_FAST   = 32;
+NORM_NFC_FAST   = 64;
+
+def is_hangul_syllable(cp):
+    return cp >= HANGUL_S_BASE and cp < HANGUL_S_BASE + HANGUL_S_COUNT;
+
+def is_surrogate(cp):
+    return cp >= 0xd800 and cp <= 0xdfff;
+
+def canonical_mapping(cp):
+    decomposition = unicodedata.decomposition(chr(cp));
+    if (decomposition == '' or decomposition[0] == '<'):
+        return None;
+
+    return [int(x, 16) for x in decomposition.split()];
+
+def full_decomposition(cp):
+    # hangul syllables are decomposed algorithmically
+    if (is_hangul_syllable(cp)):
+        return None;
+
+    mapping = canonical_mapping(cp);
+    if (mapping is None):
+        return None;
+
+    return [ord(c) for c in unicodedata.normalize("NFD", chr(cp))];
+
+def build_compositions():
+    compositions = {};
+    for cp in range(MAX_CODE_POINT + 1):
+        if (is_surrogate(cp) or is_hangul_syllable(cp)):
+            continue;
+
+        mapping = canonical_mapping(cp);
+        if (mapping is None or len(mapping) != 2):
+            continue;
+
+        # composition exclusions and non starter decompositions never get composed
+        if (unicodedata.normalize("NFC", chr(cp)) != chr(cp)):
+            continue;
+
+        compositions[(mapping[0], mapping[1])] = cp;
+
+    return compositions;
+
+def build_records(compositions):
+    backward_combiners = {second for (first, second) in compositions};
+    backward_combiners.update(range(HANGUL_V_FIRST, HANGUL_V_LAST + 1));
+    backward_combiners.update(range(HANGUL_T_FIRST, HANGUL_T_LAST + 1));
+
+    decompositions = [0];
+    decomposition_indices = {};
+
+    records = [(0, NORM_NFD_START | NORM_NFC_START | NORM_NFD_FAST | NORM_NFC_FAST, 0)];
+    record_indices = {records[0]: 0};
+    code_point_records = [0] * (MAX_CODE_POINT + 1);
+
+    for cp in range(MAX_CODE_POINT + 1):
+        if (is_surrogate(cp)):
+            continue;
+
+        c = chr(cp);
+        ccc = unicodedata.combining(c);
+        decomposition = full_decomposition(cp);
+
+        flags = 0;
+        if (decomposition is not None or is_hangul_syllable(cp)):
+            flags |= NORM_NFD_NO;
+        if (unicodedata.normalize("NFC", c) != c):
+            flags |= NORM_NFC_NO;
+        if (cp in backward_combiners):
+            flags |= NORM_NFC_MAYBE;
+
+        first = cp if decomposition is None else decomposition[0];
+        if (is_hangul_syllable(cp) or unicodedata.combining(chr(first)) == 0):
+            flags |= NORM_NFD_START;
+            if (first not in backward_combiners):
+                flags |= NORM_NFC_START;
+
+        if (ccc == 0 and (flags & NORM_NFD_NO) == 0):
+            flags |= NORM_NFD_FAST;
+        if (ccc == 0 and (flags & (NORM_NFC_NO | NORM_NFC_MAYBE)) == 0 and (flags & NORM_NFC_START)):
+            flags |= NORM_NFC_FAST;
+
+        decomposition_index = 0;
+        if (decomposition is not None):
+            key = tuple(decomposition);
+            if (key not in decomposition_indices):
+                decomposition_indices[key] = len(decompositions);
+                decompositions.append(len(decomposition));
+                decompositions.extend(decomposition);
+
+            decomposition_index = decomposition_indices[key];
+
+        record = (ccc, flags, decomposition_index);
+        if (record not in record_indices):
+            record_indices[record] = len(records);
+            records.append(record);
+
+        code_point_records[cp] = record_indices[record];
+
+    # everything past the last interesting code point uses record 0
+    limit = MAX_CODE_POINT + 1;
+    while (limit > 0 and code_point_records[limit - 1] == 0):
+        limit -= 1;
+
+    limit = (limit + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1);
+
+    blocks = [];
+    block_indices = {};
+    stage1 = [];
+    for start in range(0, limit, BLOCK_SIZE):
+        block = tuple(code_point_records[start:start + BLOCK_SIZE]);
+        if (block not in block_indices):
+            block_indices[block] = len(blocks);
+            blocks.append(block);
+
+        stage1.append(block_indices[block]);
+
+    return (limit, stage1, blocks, records, decompositions);
+
+def build_folds():
+    # simple folds are stored as the difference to the code point so the blocks of
+    # alternating upper and lower case letters all look the same and get shared
+    records = [(0, 0)];
+    record_indices = {records[0]: 0};
+    expansions = [0];
+    expansion_indices = {};
+    code_point_records = [0] * (MAX_CODE_POINT + 1);
+
+    for cp in range(MAX_CODE_POINT + 1):
+        if (is_surrogate(cp)):
+            continue;
+
+        folded = [ord(c) for c in chr(cp).casefold()];
+        if (folded == [cp]):
+            continue;
+
+        if (len(folded) == 1):
+            record = (folded[0] - cp, 0);
+        else:
+            key = tuple(folded);
+            if (key not in expansion_indices):
+                expansion_indices[key] = len(expansions);
+                expansions.append(len(folded));
+                expansions.extend(folded);
+
+            record = (0, expansion_indices[key]);
+
+        if (record not in record_indices):
+            record_indices[record] = len(records);
+            records.append(record);
+
+        code_point_records[cp] = record_indices[record];
+
+    limit = MAX_CODE_POINT + 1;
+    while (limit > 0 and code_point_records[limit - 1] == 0):
+        limit -= 1;
+
+    limit = (limit + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1);
+
+    blocks = [];
+    block_indices = {};
+    stage1 = [];
+    for start in range(0, limit, BLOCK_SIZE):
+        block = tuple(code_point_records[start:start + BLOCK_SIZE]);
+        if (block not in block_indices):
+            block_indices[block] = len(blocks);
+            blocks.append(block);
+
+        stage1.append(block_indices[block]);
+
+    max_expansion = 0;
+    for key in expansion_indices:
+        max_expansion = max(max_expansion, len(key));
+
+    return (limit, stage1, blocks, records, expansions, max_expansion);
+
+def format_array(values, per_line = 16):
+    lines = [];
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(values[i:i + per_line]) + ",");
+
+    return "\n".join(lines);
+
+def generate(output_path):
+    compositions = build_compositions();
+    (limit, stage1, blocks, records, decompositions) = build_records(compositions);
+    (fold_limit, fold_stage1, fold_blocks, fold_records, expansions, max_expansion) = build_folds();
+
+    stage2 = [];
+    for block in blocks:
+        stage2.extend(block);
+
+    out = [];
+    out.append("// generated by tools/generate_unicode_tables.py, don't edit it by hand");
+    out.append("// unicode version " + unicodedata.unidata_version);
+    out.append("");
+    out.append("#ifndef UNICODE_TABLES_H_INCLUDED");
+    out.append("#define UNICODE_TABLES_H_INCLUDED");
+    out.append("");
+    out.append("#include <stdint.h>");
+    out.append("");
+    out.append(f"#define UNICODE_TABLES_VERSION \"{unicodedata.unidata_version}\"");
+    out.append("");
+    out.append("/*");
+    out.append(" *  normalization properties, looked up through a two stage table:");
+    out.append(" *      record = unicode_norm_records[unicode_norm_stage2[(unicode_norm_stage1[cp >> UNICODE_NORM_SHIFT] << UNICODE_NORM_SHIFT) + (cp & UNICODE_NORM_MASK)]]");
+    out.append(" *  code points from UNICODE_NORM_LIMIT on all use record 0");
+    out.append(" *");
+    out.append(" *  decomposition is an index into unicode_norm_decompositions where the length is followed by the code points");
+    out.append(" *  of the full canonical decomposition (0 if there isn't one, hangul syllables are decomposed algorithmically)");
+    out.append(" */");
+    out.append(f"#define UNICODE_NORM_SHIFT {BLOCK_SHIFT}");
+    out.append(f"#define UNICODE_NORM_MASK {BLOCK_SIZE - 1}");
+    out.append(f"#define UNICODE_NORM_LIMIT {limit:#x}");
+    out.append("");
+    out.append("struct unicode_norm_record");
+    out.append("{");
+    out.append("    uint8_t ccc;");
+    out.append("    uint8_t flags;");
+    out.append("    uint16_t decomposition;");
+    out.append("};");
+    out.append("");
+    out.append(f"static const uint8_t unicode_norm_stage1[{len(stage1)}] = {{");
+    out.append(format_array([str(x) for x in stage1], 32));
+    out.append("};");
+    out.append("");
+    out.append(f"static const uint16_t unicode_norm_stage2[{len(stage2)}] = {{");
+    out.append(format_array([str(x) for x in stage2], 32));
+    out.append("};");
+    out.append("");
+    out.append(f"static const struct unicode_norm_record unicode_norm_records[{len(records)}] = {{");
+    out.append(format_array([f"{{{r[0]}, {r[1]}, {r[2]}}}" for r in records], 8));
+    out.append("};");
+    out.append("");
+    out.append(f"static const int32_t unicode_norm_decompositions[{len(decompositions)}] = {{");
+    out.append(format_array([f"{x:#x}" for x in decompositions], 12));
+    out.append("};");
+    out.append("");
+    out.append("// primary composites sorted by (first, second), hangul is done algorithmically");
+    out.append("struct unicode_norm_composition");
+    out.append("{");
+    out.append("    int32_t first, second, composite;");
+    out.append("};");
+    out.append("");
+    sorted_compositions = sorted(compositions.items());
+    out.append(f"static const struct unicode_norm_composition unicode_norm_compositions[{len(sorted_compositions)}] = {{");
+    out.append(format_array([f"{{{k[0]:#x}, {k[1]:#x}, {v:#x}}}" for (k, v) in sorted_compositions], 4));
+    out.append("};");
+    out.append("");
+
+    fold_stage2 = [];
+    for block in fold_blocks:
+        fold_stage2.extend(block);
+
+    out.append("/*");
+    out.append(" *  full case folding, looked up the same way as the normalization properties:");
+    out.append(" *      record = unicode_fold_records[unicode_fold_stage2[(unicode_fold_stage1[cp >> UNICODE_FOLD_SHIFT] << UNICODE_FOLD_SHIFT) + (cp & UNICODE_FOLD_MASK)]]");
+    out.append(" *  code points from UNICODE_FOLD_LIMIT on all use record 0 (they fold to themselves)");
+    out.append(" *");
+    out.append(" *  a simple fold adds delta to the code point, a fold to more than one character has an index into");
+    out.append(" *  unicode_fold_expansions (the length followed by the code points) in expansion");
+    out.append(" */");
+    out.append(f"#define UNICODE_FOLD_SHIFT {BLOCK_SHIFT}");
+    out.append(f"#define UNICODE_FOLD_MASK {BLOCK_SIZE - 1}");
+    out.append(f"#define UNICODE_FOLD_LIMIT {fold_limit:#x}");
+    out.append(f"#define UNICODE_FOLD_MAX_EXPANSION {max_expansion}");
+    out.append("");
+    out.append("struct unicode_fold_record");
+    out.append("{");
+    out.append("    int32_t delta;");
+    out.append("    uint16_t expansion;");
+    out.append("};");
+    out.append("");
+    out.append(f"static const uint8_t unicode_fold_stage1[{len(fold_stage1)}] = {{");
+    out.append(format_array([str(x) for x in fold_stage1], 32));
+    out.append("};");
+    out.append("");
+    out.append(f"static const uint8_t unicode_fold_stage2[{len(fold_stage2)}] = {{");
+    out.append(format_array([str(x) for x in fold_stage2], 32));
+    out.append("};");
+    out.append("");
+    out.append(f"static const struct unicode_fold_record unicode_fold_records[{len(fold_records)}] = {{");
+    out.append(format_array([f"{{{r[0]}, {r[1]}}}" for r in fold_records], 8));
+    out.append("};");
+    out.append("");
+    out.append(f"static const int32_t unicode_fold_expansions[{len(expansions)}] = {{");
+    out.append(format_array([f"{x:#x}" for x in expansions], 12));
+    out.append("};");
+    out.append("");
+    out.append("#endif // UNICODE_TABLES_H_INCLUDED");
+    out.append("");
+
+    if (len(stage1) > 0 and max(stage1) > 0xff):
+        print("stage 1 doesn't fit into uint8_t anymore, change BLOCK_SHIFT");
+        exit(1);
+
+    if (max(fold_stage1) > 0xff or len(fold_records) > 0x100):
+        print("the case folding tables don't fit into uint8_t anymore");
+        exit(1);
+
+    with open(output_path, "w", newline="\n") as f:
+        f.write("\n".join(out));
+
+output_path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "unicode_tables.h");
+if (len(sys.argv) > 1):
+    output_path = sys.argv[1];
+
+generate(output_path);
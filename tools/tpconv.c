@@ -0,0 +1,645 @@
+// tpconv - converts text between the encodings the library supports
+//
+// usage: tpconv [-f FROM] [-t TO] [-o OUTPUT] [-b] [-r] [-j THREADS] [INPUT]
+//
+//   -f FROM     encoding of the input, "auto" (the default) looks for a BOM and goes with utf-8 if there isn't one
+//   -t TO       encoding of the output (utf-8 by default)
+//   -o OUTPUT   output file, stdout if it's not given or it's "-"
+//   -b          write a BOM at the start of the output (the BOM of the input is never copied)
+//   -r          replace invalid input with U+FFFD and characters that can't be encoded in TO with '?' instead of failing
+//   -j THREADS  convert regular files with this many threads (in chunks of TPCONV_THREAD_CHUNK bytes)
+//
+// the input is read in big blocks that get decoded with a memory reader (textreader_read) into a buffer of
+// characters, which is then encoded with textprocessing_encode_chrs, so nothing goes through getc character by character
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <ctype.h>
+
+#include <textprocessing/textprocessing.h>
+#include <textprocessing/textreader.h>
+
+#if defined(_WIN32)
+    #include <io.h>
+    #include <fcntl.h>
+    #include <malloc.h>
+#endif
+
+#ifdef TPCONV_HAVE_THREADS
+    #include <pthread.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+#define TPCONV_BLOCK_SIZE    (1 << 20)
+#define TPCONV_CHARS_SIZE    (1 << 16)
+#define TPCONV_ALIGNMENT     64
+#define TPCONV_THREAD_CHUNK  (4 << 20)
+#define TPCONV_MAX_THREADS   64
+
+typedef struct tpconv_options
+{
+    textprocessing_encoding_t from;
+    textprocessing_encoding_t to;
+    const char *input;
+    const char *output;
+    int bom;
+    int replace;
+    int threads;
+} tpconv_options_t;
+
+// what converting a range of the input ended with
+typedef struct tpconv_result
+{
+    int failed;
+    size_t error_offset;    // offset of the invalid sequence in the input
+    int32_t unencodable;    // the character that couldn't be encoded, -1 if the input was invalid
+    size_t replaced;
+} tpconv_result_t;
+
+static const struct
+{
+    const char *name;
+    textprocessing_encoding_t encoding;
+} tpconv_encodings[] = {
+    { "ascii",          TPENC_ASCII },
+    { "utf-8",          TPENC_UTF8 },
+    { "utf8",           TPENC_UTF8 },
+    { "latin1",         TPENC_LATIN1 },
+    { "iso-8859-1",     TPENC_LATIN1 },
+    { "cp1252",         TPENC_CP1252 },
+    { "windows-1252",   TPENC_CP1252 },
+    { "utf-16",         TPENC_UTF16 },
+    { "utf-16le",       TPENC_UTF16LE },
+    { "utf-16be",       TPENC_UTF16BE },
+    { "utf-32",         TPENC_UTF32 },
+    { "utf-32le",       TPENC_UTF32LE },
+    { "utf-32be",       TPENC_UTF32BE },
+};
+
+#define TPCONV_ENCODING_COUNT (sizeof(tpconv_encodings) / sizeof(*tpconv_encodings))
+
+static const char *tpconv_encoding_name(textprocessing_encoding_t encoding)
+{
+    for (size_t i = 0; i < TPCONV_ENCODING_COUNT; ++i)
+    {
+        if (tpconv_encodings[i].encoding == encoding)
+            return tpconv_encodings[i].name;
+    }
+    return "?";
+}
+
+static int tpconv_parse_encoding(const char *name, textprocessing_encoding_t *encoding)
+{
+    for (size_t i = 0; i < TPCONV_ENCODING_COUNT; ++i)
+    {
+        const char *a = tpconv_encodings[i].name, *b = name;
+        while (*a && tolower((unsigned char)*b) == *a)
+        {
+            ++a;
+            ++b;
+        }
+        if (*a == 0 && *b == 0)
+        {
+            *encoding = tpconv_encodings[i].encoding;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+static void *tpconv_aligned_alloc(size_t size)
+{
+#if defined(_WIN32)
+    return _aligned_malloc(size, TPCONV_ALIGNMENT);
+#else
+    void *ptr;
+    return posix_memalign(&ptr, TPCONV_ALIGNMENT, size) == 0 ? ptr : NULL;
+#endif
+}
+
+static void tpconv_aligned_free(void *ptr)
+{
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+// the longest prefix of the text that doesn't end in the middle of a character
+static size_t tpconv_boundary(textprocessing_encoding_t encoding, const uint8_t *text, size_t len)
+{
+    if (TPENC_IS_UTF32(encoding))
+        return len & ~(size_t)3;
+
+    if (TPENC_IS_UTF16(encoding))
+    {
+        len &= ~(size_t)1;
+        if (len < 2)
+            return len;
+
+        int high = textprocessing_is_big_endian(encoding) ? 0 : 1;
+        uint8_t last = text[len - 2 + high];
+        return (last & 0xfc) == 0xd8 ? len - 2 : len;
+    }
+    if (encoding != TPENC_UTF8)
+        return len;
+
+    // go back to the byte that starts the last character and see if all of it is there
+    size_t start = len;
+    while (start > 0 && len - start < 4 && (text[start - 1] & 0xc0) == 0x80)
+        --start;
+
+    if (start == 0)
+        return len;
+
+    uint8_t lead = text[start - 1];
+    size_t need = lead >= 0xf0 ? 4 : lead >= 0xe0 ? 3 : lead >= 0xc0 ? 2 : 1;
+    return len - (start - 1) < need ? start - 1 : len;
+}
+
+/*
+ *  converts text that ends at a character boundary (or at the end of the input) into out
+ *  out needs space for TPCONV_CHARS_SIZE * 4 bytes, write is called for every batch
+ */
+typedef int (*tpconv_write_fn)(void *context, const uint8_t *data, size_t len);
+
+static int tpconv_convert(const tpconv_options_t *options, textprocessing_encoding_t from, const uint8_t *text, size_t len,
+                          int32_t *chars, uint8_t *out, tpconv_write_fn write, void *context, tpconv_result_t *result)
+{
+    textreader_t reader = textreader_openmem(text, len, from);
+    if (options->replace)
+        reader.flags |= TRFLG_REPLACE_INVALID;
+
+    // U+FFFD that couldn't be encoded, some of them are what the reader put in for invalid input
+    size_t replaced_fffd = 0;
+    for (;;)
+    {
+        size_t batch_start = reader.data.mem.index;
+        size_t n = textreader_read(&reader, chars, TPCONV_CHARS_SIZE);
+        size_t done = 0;
+        while (done < n)
+        {
+            size_t encoded;
+            size_t used = textprocessing_encode_chrs(options->to, chars + done, n - done, out, &encoded);
+            done += encoded;
+            if (done < n)
+            {
+                if (!options->replace)
+                {
+                    result->failed = 1;
+                    result->unencodable = chars[done];
+                    textreader_close(&reader, 0);
+                    return -1;
+                }
+                out[used++] = '?';
+                if (chars[done++] == 0xfffd)
+                    ++replaced_fffd;
+                else ++result->replaced;
+            }
+            if (write(context, out, used) != 0)
+            {
+                textreader_close(&reader, 0);
+                return -1;
+            }
+        }
+        if (textreader_error(&reader))
+        {
+            // find the exact spot, the reader only says that something after the start of this batch was invalid
+            size_t offset = batch_start;
+            int32_t chr;
+            int got;
+            while ((got = textprocessing_decode_chr(from, text + offset, len - offset, &chr)) > 0)
+                offset += got;
+
+            result->failed = 1;
+            result->error_offset = offset;
+            result->unencodable = -1;
+            textreader_close(&reader, 0);
+            return -1;
+        }
+        // it only reads less than it was asked to at the end of the text
+        if (n < TPCONV_CHARS_SIZE)
+            break;
+    }
+    // the invalid input is counted once, whether its U+FFFD could be encoded or not
+    size_t invalid = textreader_invalid_count(&reader, NULL);
+    result->replaced += invalid + (replaced_fffd > invalid ? replaced_fffd - invalid : 0);
+    textreader_close(&reader, 0);
+    return 0;
+}
+
+static int tpconv_write_file(void *context, const uint8_t *data, size_t len)
+{
+    if (fwrite(data, 1, len, (FILE*)context) != len)
+    {
+        fprintf(stderr, "tpconv: write failed: %s\n", strerror(errno));
+        return -1;
+    }
+    return 0;
+}
+
+static int tpconv_write_bom(FILE *out, textprocessing_encoding_t to)
+{
+    uint8_t bom[4];
+    int len = textprocessing_encode_chr(to, 0xfeff, bom);
+    return tpconv_write_file(out, bom, len);
+}
+
+// reads as much as it can into buffer, returns less than size only at EOF (or on an error)
+static size_t tpconv_fill(FILE *in, uint8_t *buffer, size_t size)
+{
+    size_t got = 0;
+    while (got < size)
+    {
+        size_t n = fread(buffer + got, 1, size - got, in);
+        if (n == 0)
+            break;
+
+        got += n;
+    }
+    return got;
+}
+
+// figures out the encoding and how long the BOM is from the start of the input
+static int tpconv_detect(const tpconv_options_t *options, const uint8_t *start, size_t len,
+                         textprocessing_encoding_t *encoding, size_t *bom_len)
+{
+    textreader_t reader = textreader_openmem(start, len, options->from);
+    if (textreader_init_encoding(&reader) != 0)
+        return -1;
+
+    *encoding = reader.encoding;
+    *bom_len = (size_t)reader.text_start_offset;
+    textreader_close(&reader, 0);
+    return 0;
+}
+
+static void tpconv_report(const tpconv_result_t *result, const tpconv_options_t *options, textprocessing_encoding_t from)
+{
+    if (result->unencodable >= 0)
+        fprintf(stderr, "tpconv: U+%04X can't be encoded in %s (use -r to replace it)\n",
+                (unsigned int)result->unencodable, tpconv_encoding_name(options->to));
+    else
+        fprintf(stderr, "tpconv: invalid %s at byte %zu (use -r to replace it)\n",
+                tpconv_encoding_name(from), result->error_offset);
+}
+
+static int tpconv_stream(const tpconv_options_t *options, FILE *in, FILE *out)
+{
+    uint8_t *block = tpconv_aligned_alloc(TPCONV_BLOCK_SIZE);
+    int32_t *chars = tpconv_aligned_alloc(TPCONV_CHARS_SIZE * sizeof(int32_t));
+    uint8_t *encoded = tpconv_aligned_alloc(TPCONV_CHARS_SIZE * 4);
+    int rv = 1;
+    if (block == NULL || chars == NULL || encoded == NULL)
+    {
+        fprintf(stderr, "tpconv: out of memory\n");
+        goto end;
+    }
+
+    size_t len = tpconv_fill(in, block, TPCONV_BLOCK_SIZE);
+    textprocessing_encoding_t from;
+    size_t start;
+    if (tpconv_detect(options, block, len, &from, &start) != 0)
+    {
+        fprintf(stderr, "tpconv: couldn't detect the encoding of the input\n");
+        goto end;
+    }
+    if (options->bom && tpconv_write_bom(out, options->to) != 0)
+        goto end;
+
+    tpconv_result_t result = { 0 };
+    size_t base = 0;   // input offset of block[0]
+    for (;;)
+    {
+        int at_eof = len < TPCONV_BLOCK_SIZE;
+        size_t end = at_eof ? len : start + tpconv_boundary(from, block + start, len - start);
+        if (tpconv_convert(options, from, block + start, end - start, chars, encoded, tpconv_write_file, out, &result) != 0)
+        {
+            if (result.failed)
+            {
+                result.error_offset += base + start;
+                tpconv_report(&result, options, from);
+            }
+            goto end;
+        }
+        if (at_eof)
+            break;
+
+        // keep the character that got cut off for the next block
+        memmove(block, block + end, len - end);
+        base += end;
+        len = len - end;
+        start = 0;
+        len += tpconv_fill(in, block + len, TPCONV_BLOCK_SIZE - len);
+    }
+    if (ferror(in))
+    {
+        fprintf(stderr, "tpconv: read failed: %s\n", strerror(errno));
+        goto end;
+    }
+    if (result.replaced > 0)
+        fprintf(stderr, "tpconv: replaced %zu characters\n", result.replaced);
+
+    rv = 0;
+end:
+    tpconv_aligned_free(block);
+    tpconv_aligned_free(chars);
+    tpconv_aligned_free(encoded);
+    return rv;
+}
+
+#ifdef TPCONV_HAVE_THREADS
+typedef struct tpconv_output
+{
+    uint8_t *data;
+    size_t size;
+} tpconv_output_t;
+
+typedef struct tpconv_job
+{
+    const tpconv_options_t *options;
+    textprocessing_encoding_t from;
+    const uint8_t *text;
+    size_t len;
+    int32_t *chars;
+    uint8_t *encoded;
+    tpconv_output_t output;
+    tpconv_result_t result;
+} tpconv_job_t;
+
+// the output buffer is big enough for the whole chunk so this never fails
+static int tpconv_write_output(void *context, const uint8_t *data, size_t len)
+{
+    tpconv_output_t *output = context;
+    memcpy(output->data + output->size, data, len);
+    output->size += len;
+    return 0;
+}
+
+static void *tpconv_thread(void *arg)
+{
+    tpconv_job_t *job = arg;
+    job->output.size = 0;
+    tpconv_convert(job->options, job->from, job->text, job->len, job->chars, job->encoded, tpconv_write_output, &job->output, &job->result);
+    return NULL;
+}
+
+/*
+ *  the file is mapped and converted in rounds, in every round each thread converts the next TPCONV_THREAD_CHUNK bytes
+ *  into its own buffer and then the buffers are written out in order, so the memory used stays the same for any file size
+ *  returns -1 if the input can't be done like that (so it falls back to streaming it)
+ */
+static int tpconv_threaded(const tpconv_options_t *options, FILE *out)
+{
+    int fd = open(options->input, O_RDONLY);
+    if (fd < 0)
+        return -1;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0)
+    {
+        close(fd);
+        return -1;
+    }
+    size_t size = (size_t)st.st_size;
+    const uint8_t *text = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (text == MAP_FAILED)
+        return -1;
+
+    madvise((void*)text, size, MADV_SEQUENTIAL);
+
+    int thread_count = options->threads;
+    tpconv_job_t jobs[TPCONV_MAX_THREADS];
+    pthread_t threads[TPCONV_MAX_THREADS];
+    memset(jobs, 0, sizeof(jobs));
+
+    int rv = 1;
+    for (int i = 0; i < thread_count; ++i)
+    {
+        jobs[i].options = options;
+        jobs[i].chars = tpconv_aligned_alloc(TPCONV_CHARS_SIZE * sizeof(int32_t));
+        jobs[i].encoded = tpconv_aligned_alloc(TPCONV_CHARS_SIZE * 4);
+        // a byte can become at most 4 (latin1 to utf-32) plus the '?' replacements that are still a byte each
+        jobs[i].output.data = tpconv_aligned_alloc((size_t)TPCONV_THREAD_CHUNK * 4 + 16);
+        if (jobs[i].chars == NULL || jobs[i].encoded == NULL || jobs[i].output.data == NULL)
+        {
+            fprintf(stderr, "tpconv: out of memory\n");
+            goto end;
+        }
+    }
+
+    textprocessing_encoding_t from;
+    size_t pos;
+    if (tpconv_detect(options, text, size, &from, &pos) != 0)
+    {
+        fprintf(stderr, "tpconv: couldn't detect the encoding of the input\n");
+        goto end;
+    }
+    if (options->bom && tpconv_write_bom(out, options->to) != 0)
+        goto end;
+
+    size_t replaced = 0;
+    while (pos < size)
+    {
+        int started = 0;
+        for (; started < thread_count && pos < size; ++started)
+        {
+            size_t len = size - pos;
+            if (len > TPCONV_THREAD_CHUNK)
+                len = tpconv_boundary(from, text + pos, TPCONV_THREAD_CHUNK);
+
+            jobs[started].from = from;
+            jobs[started].text = text + pos;
+            jobs[started].len = len;
+            memset(&jobs[started].result, 0, sizeof(jobs[started].result));
+            if (pthread_create(&threads[started], NULL, tpconv_thread, &jobs[started]) != 0)
+            {
+                tpconv_thread(&jobs[started]);
+                threads[started] = pthread_self();
+            }
+            pos += len;
+        }
+        for (int i = 0; i < started; ++i)
+        {
+            if (!pthread_equal(threads[i], pthread_self()))
+                pthread_join(threads[i], NULL);
+        }
+        for (int i = 0; i < started; ++i)
+        {
+            // what was converted before the error still gets written, like when streaming
+            if (tpconv_write_file(out, jobs[i].output.data, jobs[i].output.size) != 0)
+                goto end;
+
+            if (jobs[i].result.failed)
+            {
+                jobs[i].result.error_offset += (size_t)(jobs[i].text - text);
+                tpconv_report(&jobs[i].result, options, from);
+                goto end;
+            }
+            replaced += jobs[i].result.replaced;
+        }
+    }
+    if (replaced > 0)
+        fprintf(stderr, "tpconv: replaced %zu characters\n", replaced);
+
+    rv = 0;
+end:
+    for (int i = 0; i < thread_count; ++i)
+    {
+        tpconv_aligned_free(jobs[i].chars);
+        tpconv_aligned_free(jobs[i].encoded);
+        tpconv_aligned_free(jobs[i].output.data);
+    }
+    munmap((void*)text, size);
+    return rv;
+}
+#endif // TPCONV_HAVE_THREADS
+
+static void tpconv_usage(void)
+{
+    fprintf(stderr, "usage: tpconv [-f FROM] [-t TO] [-o OUTPUT] [-b] [-r] [-j THREADS] [INPUT]\n\nencodings:");
+    for (size_t i = 0; i < TPCONV_ENCODING_COUNT; ++i)
+        fprintf(stderr, " %s", tpconv_encodings[i].name);
+
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char **argv)
+{
+    tpconv_options_t options = {
+        .from = (textprocessing_encoding_t)-1,
+        .to = TPENC_UTF8,
+        .threads = 1
+    };
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char *arg = argv[i];
+        if (arg[0] != '-' || arg[1] == 0)
+        {
+            if (options.input != NULL)
+            {
+                tpconv_usage();
+                return 2;
+            }
+            options.input = arg;
+            continue;
+        }
+        if (strcmp(arg, "-b") == 0)
+        {
+            options.bom = 1;
+            continue;
+        }
+        if (strcmp(arg, "-r") == 0)
+        {
+            options.replace = 1;
+            continue;
+        }
+        if (arg[2] != 0 || i + 1 >= argc)
+        {
+            tpconv_usage();
+            return 2;
+        }
+        const char *value = argv[++i];
+        switch (arg[1])
+        {
+        case 'f':
+            if (strcmp(value, "auto") == 0)
+                options.from = (textprocessing_encoding_t)-1;
+            else if (tpconv_parse_encoding(value, &options.from) != 0)
+            {
+                fprintf(stderr, "tpconv: unknown encoding '%s'\n", value);
+                return 2;
+            }
+            break;
+        case 't':
+            if (tpconv_parse_encoding(value, &options.to) != 0)
+            {
+                fprintf(stderr, "tpconv: unknown encoding '%s'\n", value);
+                return 2;
+            }
+            break;
+        case 'o':
+            options.output = value;
+            break;
+        case 'j':
+            options.threads = atoi(value);
+            if (options.threads < 1 || options.threads > TPCONV_MAX_THREADS)
+            {
+                fprintf(stderr, "tpconv: the thread count has to be between 1 and %d\n", TPCONV_MAX_THREADS);
+                return 2;
+            }
+            break;
+        default:
+            tpconv_usage();
+            return 2;
+        }
+    }
+    if (options.bom && !TPENC_IS_UTF16(options.to) && !TPENC_IS_UTF32(options.to) && options.to != TPENC_UTF8)
+    {
+        fprintf(stderr, "tpconv: %s doesn't have a BOM\n", tpconv_encoding_name(options.to));
+        return 2;
+    }
+
+    if (options.input != NULL && strcmp(options.input, "-") == 0)
+        options.input = NULL;
+
+    FILE *out = stdout;
+    if (options.output != NULL && strcmp(options.output, "-") != 0)
+    {
+        out = fopen(options.output, "wb");
+        if (out == NULL)
+        {
+            fprintf(stderr, "tpconv: can't open '%s': %s\n", options.output, strerror(errno));
+            return 1;
+        }
+    }
+#if defined(_WIN32)
+    else _setmode(_fileno(stdout), _O_BINARY);
+#endif
+
+    int rv = -1;
+#ifdef TPCONV_HAVE_THREADS
+    if (options.threads > 1 && options.input != NULL)
+        rv = tpconv_threaded(&options, out);
+#endif
+    if (rv == -1)
+    {
+        FILE *in = stdin;
+        if (options.input != NULL)
+        {
+            in = fopen(options.input, "rb");
+            if (in == NULL)
+            {
+                fprintf(stderr, "tpconv: can't open '%s': %s\n", options.input, strerror(errno));
+                if (out != stdout)
+                    fclose(out);
+
+                return 1;
+            }
+        }
+#if defined(_WIN32)
+        else _setmode(_fileno(stdin), _O_BINARY);
+#endif
+        rv = tpconv_stream(&options, in, out);
+        if (in != stdin)
+            fclose(in);
+    }
+
+    if (fflush(out) != 0 && rv == 0)
+    {
+        fprintf(stderr, "tpconv: write failed: %s\n", strerror(errno));
+        rv = 1;
+    }
+    if (out != stdout)
+        fclose(out);
+
+    return rv;
+}